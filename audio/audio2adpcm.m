@@ -0,0 +1,143 @@
+% Clear command window & workspace, and close all figures
+clc, clear, close all;
+
+t_fs = 24000;         % target sample frequency
+t_dir = "c24k_adpcm"; % target sub-directory
+% Comment out t_amp to leave the signal amplitude (volume) the same
+% t_amp = 1.0;          % target max amplitude [0.0 to 1.0]
+
+% Select audio files to convert
+[fname,location] = uigetfile(...
+    '*.aifc;*.aiff;*.aif;*.au;*.flac;*.ogg;*.opus;*.mp3;*.m4a;*.mp4;*.wav',...
+    'Select one or more audio files',...
+    'MultiSelect','on');
+if isequal(fname,0) % user canceled selection
+    disp('No file(s) selected');
+    return;
+elseif ischar(fname) % convert to cell array if single file selected
+    fname = {fname};
+end
+
+% Create output sub-directory if nonexistent
+if not(isfolder(t_dir))
+    mkdir(t_dir);
+end
+
+% Process audio data
+for i = 1:length(fname)
+    % read audio wave file into a matrix
+    % returns: [data, sample frequency]
+    [x, fs] = audioread(fullfile(location,fname{i}));
+
+    % combine any channels (e.g. stereo to mono)
+    x1 = mean(x,2);
+
+    % resample at target sample frequency
+    [P,Q] = rat(t_fs/fs);
+    xs = resample(x1,P,Q);
+
+    % rescale data to the interval [-32767, 32767]
+    gain = 32767;
+    if exist('t_amp','var') == 1 % if t_amp exists, set the max amplitude
+        % change the volume if t_amp is [0.0 to 1.0]
+        max_amp = max(abs(min(xs)),abs(max(xs)));
+        gain = gain*t_amp/max_amp;
+    end
+    xr = int32(xs .* gain);
+    xr = min(xr, 32767);
+    xr = max(xr,-32767);
+
+    % encode to 4-bit IMA ADPCM and report the error of the decoded signal
+    [codes,xd] = ima_encode(xr);
+    err = double(xd) - double(xr);
+    fprintf('%s: %u samples, %u bytes, SNR %.1f dB\n', fname{i}, ...
+        length(xr), length(codes), 10*log10(sum(double(xr).^2)/max(sum(err.^2),1)));
+
+    % save data to file in a 'C' array
+    [path,name,ext] = fileparts(fname{i}); % split filename
+    path = fullfile(path,t_dir); % output to sub-directory
+    dat2c(codes,path,name,t_fs,length(xr));
+end
+
+% Encode signed 16-bit samples to IMA ADPCM, starting from predictor 0 and
+% step index 0 as the decoder (adpcm.c) expects.
+%   x: MATLAB array of signed 16-bit samples
+%   Returns the 4-bit codes packed two per byte (low nibble first), and the
+%   samples the decoder will reproduce
+function [codes,xd] = ima_encode(x)
+    step_tab = [7 8 9 10 11 12 13 14 16 17 19 21 23 25 28 31 34 37 41 45 ...
+        50 55 60 66 73 80 88 97 107 118 130 143 157 173 190 209 230 253 279 307 ...
+        337 371 408 449 494 544 598 658 724 796 876 963 1060 1166 1282 1411 1552 1707 1878 2066 ...
+        2272 2499 2749 3024 3327 3660 4026 4428 4871 5358 5894 6484 7132 7845 8630 9493 10442 11487 12635 13899 ...
+        15289 16818 18500 20350 22385 24623 27086 29794 32767];
+    index_tab = [-1 -1 -1 -1 2 4 6 8];
+    n = length(x);
+    nib = zeros(n + mod(n,2),1,'uint8'); % pad to a whole byte
+    xd = zeros(n,1,'int32');
+    pred = 0;
+    index = 0;
+    for k = 1:n
+        step = step_tab(index+1);
+        diff = double(x(k)) - pred;
+        code = 0;
+        if diff < 0; code = 8; diff = -diff; end
+        % quantize with the same truncating steps the decoder adds up
+        if diff >= step; code = code + 4; diff = diff - step; end
+        if diff >= bitshift(step,-1); code = code + 2; diff = diff - bitshift(step,-1); end
+        if diff >= bitshift(step,-2); code = code + 1; end
+        % track the decoder
+        dq = bitshift(step,-3);
+        if bitand(code,4); dq = dq + step; end
+        if bitand(code,2); dq = dq + bitshift(step,-1); end
+        if bitand(code,1); dq = dq + bitshift(step,-2); end
+        if bitand(code,8); pred = pred - dq; else; pred = pred + dq; end
+        pred = min(max(pred,-32768),32767);
+        index = min(max(index + index_tab(bitand(code,7)+1),0),88);
+        nib(k) = code;
+        xd(k) = pred;
+    end
+    codes = nib(1:2:end) + nib(2:2:end) .* 16;
+end
+
+% Given a MATLAB array of ADPCM bytes, create a 'C' array in text
+%   x: MATLAB array of uint8 data
+%   path: directory path to create 'C' file
+%   name: name of 'C' array and also files with .h and .c extension
+%   fs: sample frequency of data
+%   samples: number of samples encoded in the data
+%   Returns the length of the MATLAB array
+function l = dat2c(x,path,name,fs,samples)
+    str = upper(name);
+
+    %%%%%%%%%%%%%%%%%%%% Write .h File %%%%%%%%%%%%%%%%%%%%
+    fid_h = fopen(fullfile(path,name+".h"), 'w');
+    fprintf(fid_h, "\n#include <stdint.h>\n\n");
+    fprintf(fid_h, "// IMA ADPCM, play with sound_play_adpcm()\n");
+    fprintf(fid_h, "#define %s_SAMPLE_RATE %u\n", str, fs);
+    fprintf(fid_h, "#define %s_SAMPLES %u\n", str, samples);
+    fprintf(fid_h, "#define %s_SIZE %u\n\n", str, length(x));
+    fprintf(fid_h, "extern const uint8_t %s[%s_SIZE];\n", name, str);
+    fclose(fid_h);
+
+    %%%%%%%%%%%%%%%%%%%% Write .c File %%%%%%%%%%%%%%%%%%%%
+    ELEM_LINE = 16; % 'C' array elements per line
+    fid_c = fopen(fullfile(path,name+".c"), 'w');
+    pos = 0;
+    elem = length(x);
+
+    fprintf(fid_c, "\n#include <stdint.h>\n\n");
+    fprintf(fid_c, "const uint8_t %s[] = {\n", name); % start array
+    while elem > 0 % array data
+        if elem < ELEM_LINE; size = elem; else; size = ELEM_LINE; end
+        for i = 1:size
+            fprintf(fid_c, " 0x%02x,", x(pos+i));
+        end
+        pos = pos+size;
+        elem = elem-size;
+        fprintf(fid_c, "\n");
+    end
+    fprintf(fid_c, "};\n"); % end array
+    fclose(fid_c);
+
+    l = length(x);
+end
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""
+Pack WAV clips into one binary blob of audio assets for sound_asset_open().
+
+Each clip is mixed to mono, optionally resampled, and stored as unsigned
+8-bit PCM with its sample rate and loop points. The blob is flashed to a
+data partition and played in place from flash, so changing a sound no
+longer recompiles any source. Add a partition for it to partitions.csv,
+for example:
+    sounds,   data, 0x40,    ,        0x80000,
+and write the blob with:
+    parttool.py write_partition --partition-name sounds --input sounds.bin
+
+Usage:
+    audio2pack.py [-r RATE] -o sounds.bin clip.wav[:LOOP_START[:LOOP_END]] ...
+Loop points are in samples of the source file. LOOP_END defaults to the
+end of the clip. The asset name is the file name without its extension.
+
+Layout (little endian):
+    header  magic "SNDA", u16 version, u16 count, u32 blob size, u32 0
+    index   count entries of: char name[16], u32 offset, u32 size,
+            u32 hz, u32 loop_start, u32 loop_end (0 if no loop),
+            sorted by name
+    samples each clip at a 4-byte aligned offset
+"""
+
+import argparse
+import os
+import struct
+import sys
+import wave
+
+MAGIC = b"SNDA"
+VERSION = 1
+NAME_LEN = 16 # including the terminating NUL
+ALIGN = 4
+HEADER = struct.Struct("<4sHHII")
+ENTRY = struct.Struct("<%dsIIIII" % NAME_LEN)
+
+def read_wav(path):
+    """Read a PCM WAV file. Return the mono samples in [-1.0, 1.0) and the
+    sample rate."""
+    with wave.open(path, "rb") as w:
+        ch, width, hz = w.getnchannels(), w.getsampwidth(), w.getframerate()
+        raw = w.readframes(w.getnframes())
+    if width == 1:
+        vals = [(b - 128) / 128 for b in raw]
+    elif width == 2:
+        vals = [v / 32768 for (v,) in struct.iter_unpack("<h", raw)]
+    else:
+        sys.exit("%s: %d-bit samples not supported" % (path, 8 * width))
+    # combine any channels (e.g. stereo to mono)
+    mono = [sum(vals[i:i+ch]) / ch for i in range(0, len(vals), ch)]
+    return mono, hz
+
+def resample(x, hz, t_hz):
+    """Resample by linear interpolation."""
+    n = int(len(x) * t_hz / hz)
+    y = []
+    for i in range(n):
+        p = i * hz / t_hz
+        k = int(p)
+        f = p - k
+        b = x[k+1] if k + 1 < len(x) else x[k]
+        y.append(x[k] + (b - x[k]) * f)
+    return y
+
+def to_u8(x):
+    """Convert samples in [-1.0, 1.0) to unsigned 8-bit."""
+    return bytes(min(255, max(0, int(round(v * 128)) + 128)) for v in x)
+
+def parse_clip(arg):
+    """Split clip.wav[:start[:end]] into the path and loop points."""
+    parts = arg.split(":")
+    path = parts[0]
+    start = int(parts[1]) if len(parts) > 1 else None
+    end = int(parts[2]) if len(parts) > 2 else None
+    return path, start, end
+
+def main():
+    ap = argparse.ArgumentParser(description="Pack WAV clips into an audio asset blob.")
+    ap.add_argument("-o", "--output", required=True, help="blob file to write")
+    ap.add_argument("-r", "--rate", type=int, help="resample clips to this rate in Hz")
+    ap.add_argument("clips", nargs="+", help="clip.wav[:LOOP_START[:LOOP_END]]")
+    args = ap.parse_args()
+
+    assets = {}
+    for arg in args.clips:
+        path, start, end = parse_clip(arg)
+        name = os.path.splitext(os.path.basename(path))[0]
+        if len(name.encode()) >= NAME_LEN:
+            sys.exit("%s: name longer than %d characters" % (name, NAME_LEN - 1))
+        if name in assets:
+            sys.exit("%s: duplicate name" % name)
+        x, hz = read_wav(path)
+        if start is not None:
+            if end is None:
+                end = len(x)
+            if not 0 <= start < end <= len(x):
+                sys.exit("%s: bad loop points %d:%d" % (path, start, end))
+        if args.rate and args.rate != hz:
+            x = resample(x, hz, args.rate)
+            if start is not None:
+                # round the end up so a short loop keeps at least a sample
+                start = start * args.rate // hz
+                end = min(-(-end * args.rate // hz), len(x))
+                if not 0 <= start < end:
+                    sys.exit("%s: loop %d:%d empty at %d Hz" % (path, start, end, args.rate))
+            hz = args.rate
+        assets[name] = (to_u8(x), hz, start or 0, end or 0)
+
+    names = sorted(assets, key=lambda n: n.encode())
+    offset = HEADER.size + ENTRY.size * len(names)
+    index, data = [], b""
+    for name in names:
+        pcm, hz, start, end = assets[name]
+        pad = -offset % ALIGN
+        data += bytes(pad)
+        offset += pad
+        index.append(ENTRY.pack(name.encode(), offset, len(pcm), hz, start, end))
+        data += pcm
+        offset += len(pcm)
+        print("%-15s %6u samples %5u Hz loop %u:%u" % (name, len(pcm), hz, start, end))
+
+    blob = HEADER.pack(MAGIC, VERSION, len(names), offset, 0) + b"".join(index) + data
+    with open(args.output, "wb") as f:
+        f.write(blob)
+    print("%s: %u assets, %u bytes" % (args.output, len(names), len(blob)))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,46 @@
+#ifndef SPI_MASTER_H_
+#define SPI_MASTER_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define SPI2_HOST 1
+#define SPI_MASTER_FREQ_40M (80 * 1000 * 1000 / 2)
+#define SPI_DMA_CH_AUTO 3
+#define SPI_DEVICE_NO_DUMMY (1<<6)
+
+typedef struct spi_device_s *spi_device_handle_t;
+
+typedef struct {
+	int mosi_io_num;
+	int miso_io_num;
+	int sclk_io_num;
+	int quadwp_io_num;
+	int quadhd_io_num;
+	int max_transfer_sz;
+	uint32_t flags;
+} spi_bus_config_t;
+
+typedef struct {
+	int clock_speed_hz;
+	int queue_size;
+	int mode;
+	int spics_io_num;
+	uint32_t flags;
+} spi_device_interface_config_t;
+
+typedef struct {
+	uint32_t flags;
+	size_t length; // bits
+	const void *tx_buffer;
+	void *rx_buffer;
+} spi_transaction_t;
+
+esp_err_t spi_bus_initialize(int host, const spi_bus_config_t *cfg, int dma_chan);
+esp_err_t spi_bus_add_device(int host, const spi_device_interface_config_t *cfg,
+	spi_device_handle_t *handle);
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans);
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans);
+
+#endif // SPI_MASTER_H_
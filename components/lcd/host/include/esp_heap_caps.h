@@ -0,0 +1,12 @@
+#ifndef ESP_HEAP_CAPS_H_
+#define ESP_HEAP_CAPS_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MALLOC_CAP_DMA 1
+
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
+
+#endif // ESP_HEAP_CAPS_H_
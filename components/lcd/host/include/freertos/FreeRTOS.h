@@ -0,0 +1,23 @@
+// Host stand-in for the parts of FreeRTOS used by the LCD component.
+// Single threaded, vTaskDelay() sleeps (lcd_host.c).
+
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h> // abs, pulled in by the IDF headers
+#include <assert.h>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define configTICK_RATE_HZ 100
+#define portTICK_PERIOD_MS (1000/configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms)*configTICK_RATE_HZ/1000)
+
+#endif // FREERTOS_H_
@@ -0,0 +1,8 @@
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+void vTaskDelay(TickType_t ticks);
+
+#endif // TASK_H_
@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "esp_timer.h"
+
+#include "lcd.h"
+#include "lcd_host.h"
+#include "peppers.h"
+#include "peppers_jpg.h"
+
+// Build from the repository root, for example:
+//   gcc -O2 -Icomponents/lcd/host/include -Icomponents/lcd -Icomponents/config
+//     -Ilcd_test/main components/lcd/host/jpeg_bench.c
+//     components/lcd/host/lcd_host.c components/lcd/lcd.c
+//     components/lcd/lcd_jpeg.c lcd_test/main/peppers.c
+//     lcd_test/main/peppers_jpg.c -lm -o jpeg_bench
+
+#define PSNR_MIN 28.0 // dB, decoded peppers against the RGB565 original
+
+typedef void (*draw_t)(coord_t x, coord_t y);
+
+static void draw_rgb(coord_t x, coord_t y)
+{
+	lcd_drawRGBBitmap(x, y, peppers, PEPPERS_W, PEPPERS_H);
+}
+
+static void draw_jpeg(coord_t x, coord_t y)
+{
+	lcd_drawJpeg(x, y, peppers_jpg, PEPPERS_JPG_SIZE);
+}
+
+// Draw the image along the same path as lcd_test_drawRGBBitmap() and
+// return the average time per image in us.
+static double bench(draw_t draw)
+{
+	coord_t x = 0, y = 0;
+	int64_t start = esp_timer_get_time();
+	for (; y < 10; y++) draw(x, y);
+	for (; x < 10; x++) draw(x, y);
+	for (; y > 0; y--) draw(x, y);
+	for (; x > 0; x--) draw(x, y);
+	return (esp_timer_get_time() - start) / 40.0;
+}
+
+// Peak signal to noise ratio of the frame buffer against the original,
+// over the RGB565 fields scaled to 8 bits.
+static double psnr(const color_t *fb)
+{
+	coord_t w = lcd_getWidth(), h = lcd_getHeight();
+	if (w > PEPPERS_W) w = PEPPERS_W;
+	if (h > PEPPERS_H) h = PEPPERS_H;
+	double err = 0;
+	for (coord_t y = 0; y < h; y++) {
+		for (coord_t x = 0; x < w; x++) {
+			color_t a = fb[y*lcd_getWidth() + x], b = peppers[y*PEPPERS_W + x];
+			double dr = ((a >> 11) - (b >> 11)) * 255.0/31;
+			double dg = (((a >> 5) & 63) - ((b >> 5) & 63)) * 255.0/63;
+			double db = ((a & 31) - (b & 31)) * 255.0/31;
+			err += dr*dr + dg*dg + db*db;
+		}
+	}
+	err /= 3.0 * w * h;
+	return err ? 10*log10(255.0*255.0 / err) : INFINITY;
+}
+
+// Return a copy of the image with the first AC Huffman table changed by
+// mod(), or NULL if there is no such table.
+static uint8_t *bad_dht(void (*mod)(uint8_t *tab))
+{
+	uint8_t *p = malloc(PEPPERS_JPG_SIZE);
+	memcpy(p, peppers_jpg, PEPPERS_JPG_SIZE);
+	for (size_t i = 2; i + 4 < PEPPERS_JPG_SIZE; i += 2 + (p[i+2] << 8 | p[i+3])) {
+		if (p[i] != 0xFF) break;
+		if (p[i+1] != 0xC4) continue;
+		uint8_t *t = p+i+4, *end = p+i+2 + (p[i+2] << 8 | p[i+3]);
+		while (t + 17 <= end) { // tables in the segment
+			uint32_t total = 0;
+			for (uint32_t l = 1; l <= 16; l++) total += t[l];
+			if (t[0] >> 4 == 1) {mod(t); return p;}
+			t += 17 + total;
+		}
+	}
+	free(p);
+	return NULL;
+}
+
+// Make all the codes 1 bit long. Without the length check their lookup
+// entries run far past the table.
+static void overflow(uint8_t *tab)
+{
+	for (uint32_t l = 2; l <= 16; l++) {
+		tab[1] += tab[l];
+		tab[l] = 0;
+	}
+}
+
+// Use table id 2, which baseline allows only 0 and 1 of.
+static void table2(uint8_t *tab)
+{
+	tab[0] = (tab[0] & 0xF0) | 2;
+}
+
+// Time decode+draw of the lcd_test peppers scene against the RGB565 array,
+// both into the frame buffer and streamed to the controller, and report the
+// flash saved. Check the decoded image against the original, and that
+// malformed Huffman tables are rejected.
+// Usage: jpeg_bench
+int main(void)
+{
+	uint32_t fails = 0;
+
+	lcd_init();
+	printf("flash[bytes] rgb565:%u jpeg:%u saved:%u\n",
+		(unsigned)sizeof(peppers), (unsigned)PEPPERS_JPG_SIZE,
+		(unsigned)(sizeof(peppers)-PEPPERS_JPG_SIZE));
+
+	double rgb = bench(draw_rgb), jpeg = bench(draw_jpeg);
+	printf("stream[us/image] rgb565:%.0f jpeg:%.0f\n", rgb, jpeg);
+	lcd_frameEnable();
+	rgb = bench(draw_rgb);
+	jpeg = bench(draw_jpeg);
+	printf("frame[us/image]  rgb565:%.0f jpeg:%.0f\n", rgb, jpeg);
+
+	lcd_fillScreen(BLACK);
+	if (lcd_drawJpeg(0, 0, peppers_jpg, PEPPERS_JPG_SIZE)) {
+		printf("decode failed\n");
+		fails++;
+	}
+	double q = psnr(lcd_getFrameBuffer());
+	printf("psnr[dB] %.1f\n", q);
+	if (q < PSNR_MIN) {
+		printf("psnr below %.1f dB\n", PSNR_MIN);
+		fails++;
+	}
+
+	void (*mod[])(uint8_t *) = {overflow, table2};
+	const char *name[] = {"overflowing", "id 2"};
+	for (uint32_t i = 0; i < 2; i++) {
+		uint8_t *p = bad_dht(mod[i]);
+		if (!p || lcd_drawJpeg(0, 0, p, PEPPERS_JPG_SIZE) == 0) {
+			printf("%s Huffman table not rejected\n", name[i]);
+			fails++;
+		}
+		free(p);
+	}
+	lcd_frameDisable();
+
+	if (fails) printf("%u checks failed\n", (unsigned)fails);
+	return fails ? EXIT_FAILURE : EXIT_SUCCESS;
+}
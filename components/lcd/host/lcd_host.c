@@ -0,0 +1,121 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+
+#include "hw.h"
+#include "lcd_host.h"
+
+static uint32_t dc; // level of the D/C pin, 0 for a command
+static uint8_t cur; // command taking parameters
+static uint8_t param[256][LCD_HOST_PARAMS];
+static int32_t plen[256]; // parameter bytes of the last of each command, -1 if none
+static bool sent[256];
+static uint64_t bytes;
+
+
+// Get the parameters last sent with a controller command.
+// cmd: command byte (e.g. 0x36 for MADCTL).
+// data: where to put up to LCD_HOST_PARAMS bytes.
+// Return the number of parameter bytes, or -1 if the command was not sent.
+int32_t lcd_host_param(uint8_t cmd, uint8_t *data)
+{
+	if (!sent[cmd]) return -1;
+	int32_t n = (plen[cmd] < LCD_HOST_PARAMS) ? plen[cmd] : LCD_HOST_PARAMS;
+	memcpy(data, param[cmd], n);
+	return plen[cmd];
+}
+
+// Return the number of data bytes sent to the controller since start.
+uint64_t lcd_host_bytes(void)
+{
+	return bytes;
+}
+
+//----------------------------------------------------------------------------//
+// Driver stand-ins
+
+esp_err_t spi_bus_initialize(int host, const spi_bus_config_t *cfg, int dma_chan)
+{
+	return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(int host, const spi_device_interface_config_t *cfg,
+	spi_device_handle_t *handle)
+{
+	*handle = (spi_device_handle_t)&cur; // any non-NULL handle
+	return ESP_OK;
+}
+
+// A command byte starts a new parameter list, data bytes extend it.
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+	const uint8_t *p = trans->tx_buffer;
+	size_t n = trans->length / 8;
+
+	if (dc == 0) {
+		if (n != 1) return ESP_FAIL;
+		cur = p[0];
+		sent[cur] = true;
+		plen[cur] = 0;
+		return ESP_OK;
+	}
+	size_t k = 0;
+	while (k < n && plen[cur] < LCD_HOST_PARAMS) param[cur][plen[cur]++] = p[k++];
+	plen[cur] += n - k; // count, but don't keep, pixels
+	bytes += n;
+	return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans)
+{
+	return spi_device_polling_transmit(handle, trans);
+}
+
+esp_err_t gpio_reset_pin(int gpio)
+{
+	return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(int gpio, int mode)
+{
+	return ESP_OK;
+}
+
+esp_err_t gpio_set_level(int gpio, uint32_t level)
+{
+	if (gpio == HW_LCD_DC) dc = level;
+	return ESP_OK;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps)
+{
+	return malloc(size);
+}
+
+void heap_caps_free(void *ptr)
+{
+	free(ptr);
+}
+
+int64_t esp_timer_get_time(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1000000LL + ts.tv_nsec/1000;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+	struct timespec ts = {
+		.tv_sec = ticks*portTICK_PERIOD_MS / 1000,
+		.tv_nsec = ticks*portTICK_PERIOD_MS % 1000 * 1000000L,
+	};
+	nanosleep(&ts, NULL);
+}
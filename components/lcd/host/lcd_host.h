@@ -0,0 +1,29 @@
+#ifndef LCD_HOST_H_
+#define LCD_HOST_H_
+
+#include <stdint.h>
+
+// This is a host (Linux) backend for the LCD component. It stands in for
+// the SPI and GPIO drivers and keeps the parameters of the last controller
+// command of each kind (MADCTL, CASET, RASET, ...) so the display setup
+// can be checked on a PC. Pixel data is counted but not kept.
+//
+// Build from the repository root, for example:
+//   gcc -O2 -Icomponents/lcd/host/include -Icomponents/lcd -Icomponents/config
+//     components/lcd/host/rotation.c components/lcd/host/lcd_host.c
+//     components/lcd/lcd.c -lm -o rotation
+// Add -DHW_TARGET_LTAG for the LTAG board instead of the GC board.
+
+// Number of parameter bytes kept for each command.
+#define LCD_HOST_PARAMS 8
+
+// Get the parameters last sent with a controller command.
+// cmd: command byte (e.g. 0x36 for MADCTL).
+// data: where to put up to LCD_HOST_PARAMS bytes.
+// Return the number of parameter bytes, or -1 if the command was not sent.
+int32_t lcd_host_param(uint8_t cmd, uint8_t *data);
+
+// Return the number of data bytes sent to the controller since start.
+uint64_t lcd_host_bytes(void);
+
+#endif // LCD_HOST_H_
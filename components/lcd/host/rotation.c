@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lcd.h"
+#include "lcd_host.h"
+
+#define MADCTL 0x36 // Memory Data Access Control
+#define CASET  0x2A // Column Address Set
+#define RASET  0x2B // Row Address Set
+
+#define MY 0x80
+#define MX 0x40
+#define MV 0x20
+
+// Expected setup of each rotation, from the controller datasheets.
+typedef struct {
+	uint8_t madctl;
+	coord_t w, h;
+	coord_t offx, offy; // address of the top left pixel
+} rot_t;
+
+#if defined(HW_TARGET_LTAG)
+// ST7789, 240x320 frame memory behind a 240x240 panel at the top. Upside
+// down (MY), the panel rows are at the end of memory, 80 rows in.
+#define BOARD "LTAG"
+#define RAM_W 240
+#define RAM_H 320
+#define BGR 0x00
+static const rot_t rot[4] = {
+	{BGR,           240, 240,  0,  0},
+	{BGR | MV | MX, 240, 240,  0,  0},
+	{BGR | MX | MY, 240, 240,  0, 80},
+	{BGR | MV | MY, 240, 240, 80,  0},
+};
+#else
+// ILI9342, 320x240 frame memory, all of it on the panel.
+#define BOARD "GC"
+#define RAM_W 320
+#define RAM_H 240
+#define BGR 0x08
+static const rot_t rot[4] = {
+	{BGR,           320, 240, 0, 0},
+	{BGR | MV | MX, 240, 320, 0, 0},
+	{BGR | MX | MY, 320, 240, 0, 0},
+	{BGR | MV | MY, 240, 320, 0, 0},
+};
+#endif
+
+// Panel corners in frame memory at DIRECTION0, clockwise from top left.
+static const coord_t corner[4][2] = {
+	{0, 0}, {HW_LCD_W-1, 0}, {HW_LCD_W-1, HW_LCD_H-1}, {0, HW_LCD_H-1},
+};
+
+static uint32_t fails;
+
+static void check(bool ok, const char *what, uint32_t r)
+{
+	if (ok) return;
+	printf("%s rotation %u: %s wrong\n", BOARD, (unsigned)r*90, what);
+	fails++;
+}
+
+// Draw a pixel and return where the controller puts it in frame memory.
+// The addresses are mapped the way the controller does: exchanged by MV,
+// then the memory column mirrored by MX and the row by MY.
+static void plot(coord_t x, coord_t y, int32_t *mx, int32_t *my)
+{
+	uint8_t ca[LCD_HOST_PARAMS], ra[LCD_HOST_PARAMS], m;
+
+	lcd_drawPixel(x, y, WHITE);
+	lcd_host_param(MADCTL, &m);
+	lcd_host_param(CASET, ca);
+	lcd_host_param(RASET, ra);
+	int32_t c = ca[0] << 8 | ca[1], r = ra[0] << 8 | ra[1];
+	if (m & MV) { int32_t t = c; c = r; r = t; }
+	*mx = (m & MX) ? RAM_W-1 - c : c;
+	*my = (m & MY) ? RAM_H-1 - r : r;
+}
+
+// Check the MADCTL bits, size and offsets of each rotation, and that the
+// corners of the screen land on the panel corners turned clockwise.
+// Usage: rotation
+int main(void)
+{
+	lcd_init();
+	for (uint32_t r = 0; r < 4; r++) {
+		uint8_t m;
+		int32_t x, y;
+
+		lcd_setRotation(r);
+		check(lcd_host_param(MADCTL, &m) == 1 && m == rot[r].madctl, "MADCTL", r);
+		check(lcd_getRotation() == r, "rotation", r);
+		check(lcd_getWidth() == rot[r].w && lcd_getHeight() == rot[r].h, "size", r);
+		coord_t w = lcd_getWidth(), h = lcd_getHeight();
+
+		uint8_t ca[LCD_HOST_PARAMS], ra[LCD_HOST_PARAMS];
+		lcd_drawPixel(0, 0, WHITE);
+		lcd_host_param(CASET, ca);
+		lcd_host_param(RASET, ra);
+		check((ca[0] << 8 | ca[1]) == rot[r].offx && (ra[0] << 8 | ra[1]) == rot[r].offy, "offset", r);
+
+		// Screen corners clockwise from top left are the panel corners
+		// starting r steps further round.
+		const coord_t scr[4][2] = {{0, 0}, {w-1, 0}, {w-1, h-1}, {0, h-1}};
+		for (uint32_t k = 0; k < 4; k++) {
+			plot(scr[k][0], scr[k][1], &x, &y);
+			check(x == corner[(k+r) % 4][0] && y == corner[(k+r) % 4][1], "corner", r);
+		}
+		printf("%s rotation %3u: MADCTL %02X, %dx%d, offset %d,%d\n", BOARD, (unsigned)r*90,
+			m, w, h, rot[r].offx, rot[r].offy);
+	}
+	if (fails) printf("%u checks failed\n", (unsigned)fails);
+	return fails ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -15,6 +15,7 @@
 #include "driver/gpio.h"
 #include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 
 #include "hw.h"
 #include "lcd.h"
@@ -36,6 +37,28 @@
 #define LCD_OFFSETY HW_LCD_OFFSETY
 
 #define LCD_DRIVER HW_LCD_DRIVER
+#define LCD_DIR    HW_LCD_DIR
+
+// MADCTL (36h) bits for rotation, relative to the init table setting.
+#define MADCTL_MY 0x80 // row address order
+#define MADCTL_MX 0x40 // column address order
+#define MADCTL_MV 0x20 // row/column exchange
+
+#if LCD_DRIVER == 0
+#define MADCTL_BASE 0x08 // BGR
+#elif LCD_DRIVER == 1
+#define MADCTL_BASE 0x00
+#endif
+
+// Controller frame memory size at DIRECTION0. The ST7789 has 240x320
+// of memory, so a 240x240 panel needs a different offset upside down.
+#if LCD_DRIVER == 1
+#define LCD_RAM_W 240
+#define LCD_RAM_H 320
+#else
+#define LCD_RAM_W (LCD_W+LCD_OFFSETX)
+#define LCD_RAM_H (LCD_H+LCD_OFFSETY)
+#endif
 
 #define swap(T,a,b) {T t = (a); (a) = (b); (b) = t;}
 
@@ -48,10 +71,12 @@ typedef struct {
 	coord_t     height;
 	coord_t     offsetx;
 	coord_t     offsety;
+	direction_t rotation;
 	direction_t font_direction;
 	uint8_t     font_size;
 	bool        font_back_en;
 	color_t     font_back_color;
+	fill_rule_t fill_rule;
 	int8_t      res;
 	int8_t      dc;
 	int8_t      bl;
@@ -74,9 +99,6 @@ static int32_t clock_freq_hz = LCD_SPI_FREQ;
 
 #include "glcdfont.c" // unsigned char font[];
 
-#define delayMS(ms) \
-	vTaskDelay(((ms)+(portTICK_PERIOD_MS-1))/portTICK_PERIOD_MS)
-
 //----------------------------------------------------------------------------//
 // SPI
 //----------------------------------------------------------------------------//
@@ -245,8 +267,107 @@ inline static bool spi_master_write_colors(TFT_t *dev, const color_t *colors, si
 // LCD
 //----------------------------------------------------------------------------//
 
+// Init tables are a byte stream of entries: cmd, len, data[len & INIT_LEN],
+// and a delay in ms if INIT_DELAY is set in len. INIT_RESET_WAIT holds the
+// command until the reset window has elapsed (Sleep Out must not be sent
+// sooner than 120 ms after a hardware reset).
+#define INIT_DELAY      0x80
+#define INIT_RESET_WAIT 0x40
+#define INIT_LEN        0x3F
+
+#define RESET_LOW_US   1000 // reset pulse width (>= 10 us)
+#define RESET_CMD_US   5000 // after reset, before the first command
+#define RESET_WAIT_US 120000 // after reset, before Sleep Out
+
+#if LCD_INV
+#define INIT_INVERSION 0x21, 0 // ILI:Display Inversion ON (21h), ST:INVON (21h)
+#else
+#define INIT_INVERSION 0x20, 0 // ILI:Display Inversion OFF (20h), ST:INVOFF (20h)
+#endif
+
+#if LCD_DRIVER == 0
+static const uint8_t init_cmds[] = {
+	0x3A, 1, 0x55,                   // ILI:COLMOD: Pixel Format Set (3Ah), ST:COLMOD (3Ah): Interface Pixel Format
+	0x36, 1, 0x08,                   // ILI:Memory Access Control (36h), ST:MADCTL (36h): Memory Data Access Control
+	0xCF, 3, 0x00, 0xC3, 0x30,       // ILI:Power control B (CFh), ILI9341 only
+	0xED, 4, 0x64, 0x03, 0x12, 0x81, // ILI:Power on sequence control (EDh), ILI9341 only
+	0xE8, 3, 0x85, 0x00, 0x78,       // ILI:Driver timing control A (E8h), ST:PWCTRL2 (E8h): Power Control 2
+	0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02, // ILI:Power control A (CBh), ILI9341 only
+	0xF7, 1, 0x20,                   // ILI:Pump ratio control (F7h), ILI9341 only
+	0xEA, 2, 0x00, 0x00,             // ILI:Driver timing control B (EAh), ILI9341 only
+	0xC0, 1, 0x1B,                   // ILI:Power Control 1 (C0h), ST:LCMCTRL (C0h): LCM Control
+	0xC1, 1, 0x12,                   // ILI:Power Control 2 (C1h), ST:IDSET (C1h): ID Code Setting
+	0xC5, 2, 0x32, 0x3C,             // ILI:VCOM Control 1(C5h), ST:VCMOFSET (C5h): VCOM Offset Set
+	0xC7, 1, 0x91,                   // ILI:VCOM Control 2(C7h), ST:CABCCTRL (C7h): CABC Control
+	0xB1, 2, 0x00, 0x10,             // ILI:Frame Rate Control (In Normal Mode/Full Colors) (B1h), ST:RGBCTRL (B1h): RGB Interface Control
+	0xB6, 2, 0x0A, 0xA2,             // ILI:Display Function Control (B6h), ILI9341 only
+	0xF6, 2, 0x01, 0x30,             // ILI:Interface Control (F6h), ILI9341 only
+	0x11, INIT_RESET_WAIT|INIT_DELAY|0, 5, // ILI:Sleep Out (11h), ST:SLPOUT (11h): Sleep Out
+	INIT_INVERSION,
+};
+#elif LCD_DRIVER == 1
+static const uint8_t init_cmds[] = {
+	0x36, 1, 0x00,                   // MADCTL (36h): Memory Data Access Control
+	0x3A, 1, 0x05,                   // COLMOD (3Ah): Interface Pixel Format
+	0xB2, 5, 0x0C, 0x0C, 0x00, 0x33, 0x33, // PORCTRL (B2h): Porch Setting
+	0xB7, 1, 0x35,                   // GCTRL (B7h): Gate Control
+	0xBB, 1, 0x19,                   // VCOMS (BBh): VCOM Setting
+	0xC0, 1, 0x2C,                   // LCMCTRL (C0h): LCM Control
+	0xC2, 1, 0x01,                   // VDVVRHEN (C2h): VDV and VRH Command Enable
+	0xC3, 1, 0x12,                   // VRHS (C3h): VRH Set
+	0xC4, 1, 0x20,                   // VDVS (C4h): VDV Set
+	0xC6, 1, 0x0F,                   // FRCTRL2 (C6h): Frame Rate Control in Normal Mode
+	0xD0, 2, 0xA4, 0xA1,             // PWCTRL1 (D0h): Power Control 1
+	0xE0, 14, 0xD0, 0x04, 0x0D, 0x11, 0x13, 0x2B, 0x3F, // PVGAMCTRL (E0h): Positive Voltage Gamma Control
+	          0x54, 0x4C, 0x18, 0x0D, 0x0B, 0x1F, 0x23,
+	0xE1, 14, 0xD0, 0x04, 0x0C, 0x11, 0x13, 0x2C, 0x3F, // NVGAMCTRL (E1h): Negative Voltage Gamma Control
+	          0x44, 0x51, 0x2F, 0x1F, 0x1F, 0x20, 0x23,
+	0x11, INIT_RESET_WAIT|INIT_DELAY|0, 5, // SLPOUT (11h): Sleep Out
+	INIT_INVERSION,
+};
+#endif
+
+static int64_t t_init;         // lcd_init() entry time
+static int64_t init_us;        // lcd_init() entry to display on
+static int64_t first_frame_us; // lcd_init() entry to first lcd_writeFrame()
+
+// Wait until an esp_timer time. Sleeps for whole ticks, then spins, so
+// short waits are not rounded up to a tick period.
+static void lcd_waitUntil(int64_t t)
+{
+	const int64_t tick_us = portTICK_PERIOD_MS * 1000;
+	int64_t rem;
+
+	while ((rem = t - esp_timer_get_time()) > 0) {
+		if (rem >= 2*tick_us) vTaskDelay(rem / tick_us - 1);
+	}
+}
+
+// Send each command with its parameters in one data transaction.
+static void lcd_runInitTable(const uint8_t *p, size_t size, int64_t t_reset)
+{
+	const uint8_t *end = p + size;
+	uint8_t *data = (uint8_t *)buffer; // DMA capable, tables may be in flash
+
+	while (p < end) {
+		uint8_t cmd = *p++;
+		uint8_t flags = *p++;
+		uint8_t len = flags & INIT_LEN;
+		if (flags & INIT_RESET_WAIT) lcd_waitUntil(t_reset + RESET_WAIT_US);
+		spi_master_write_command(dev, cmd);
+		if (len) {
+			memcpy(data, p, len);
+			gpio_set_level(dev->dc, SPI_Data_Mode);
+			spi_master_write_bytes(dev->SPIHandle, data, len);
+			p += len;
+		}
+		if (flags & INIT_DELAY) lcd_waitUntil(esp_timer_get_time() + *p++ * 1000);
+	}
+}
+
 void lcd_init(void)
 {
+	t_init = esp_timer_get_time();
 	spi_master_init(dev,
 		LCD_MOSI,
 		LCD_SCLK,
@@ -255,170 +376,50 @@ void lcd_init(void)
 		LCD_RST,
 		LCD_BL);
 
+	int64_t t_reset = t_init;
 	if (dev->res >= 0) {
 		gpio_set_level(dev->res, 0);
-		delayMS(20);
+		lcd_waitUntil(esp_timer_get_time() + RESET_LOW_US);
 		gpio_set_level(dev->res, 1);
-		delayMS(120);
+		t_reset = esp_timer_get_time();
+		lcd_waitUntil(t_reset + RESET_CMD_US);
 	}
 
 	dev->width = LCD_W;
 	dev->height = LCD_H;
 	dev->offsetx = LCD_OFFSETX;
 	dev->offsety = LCD_OFFSETY;
+	dev->rotation = DIRECTION0;
 	dev->font_direction = DIRECTION0;
 	dev->font_size = 1;
 	dev->font_back_en = false;
 	dev->font_back_color = BLACK;
+	dev->fill_rule = FILL_EVEN_ODD;
 	dev->use_frame_buffer = false;
 	dev->frame_buffer = NULL;
 
-#if LCD_DRIVER == 0
-	// spi_master_write_command(dev, 0x01);    // ILI:Software Reset (01h), ST:SWRESET (01h): Software Reset
-	// delayMS(5);
-
-	spi_master_write_command(dev, 0x3A);    // ILI:COLMOD: Pixel Format Set (3Ah), ST:COLMOD (3Ah): Interface Pixel Format
-	spi_master_write_data_byte(dev, 0x55);
-	// delayMS(10);
-
-	spi_master_write_command(dev, 0x36);    // ILI:Memory Access Control (36h), ST:MADCTL (36h): Memory Data Access Control
-	spi_master_write_data_byte(dev, 0x08);  // 0x00
-
-	spi_master_write_command(dev, 0xCF);    // ILI:Power control B (CFh), ILI9341 only
-	spi_master_write_data_byte(dev, 0x00);
-	spi_master_write_data_byte(dev, 0xc3);
-	spi_master_write_data_byte(dev, 0x30);
-	spi_master_write_command(dev, 0xED);    // ILI:Power on sequence control (EDh), ILI9341 only
-	spi_master_write_data_byte(dev, 0x64);
-	spi_master_write_data_byte(dev, 0x03);
-	spi_master_write_data_byte(dev, 0x12);
-	spi_master_write_data_byte(dev, 0x81);
-	spi_master_write_command(dev, 0xE8);    // ILI:Driver timing control A (E8h), ST:PWCTRL2 (E8h): Power Control 2
-	spi_master_write_data_byte(dev, 0x85);
-	spi_master_write_data_byte(dev, 0x00);
-	spi_master_write_data_byte(dev, 0x78);
-	spi_master_write_command(dev, 0xCB);    // ILI:Power control A (CBh), ILI9341 only
-	spi_master_write_data_byte(dev, 0x39);
-	spi_master_write_data_byte(dev, 0x2c);
-	spi_master_write_data_byte(dev, 0x00);
-	spi_master_write_data_byte(dev, 0x34);
-	spi_master_write_data_byte(dev, 0x02);
-	spi_master_write_command(dev, 0xF7);    // ILI:Pump ratio control (F7h), ILI9341 only
-	spi_master_write_data_byte(dev, 0x20);
-	spi_master_write_command(dev, 0xEA);    // ILI:Driver timing control B (EAh), ILI9341 only
-	spi_master_write_data_byte(dev, 0x00);
-	spi_master_write_data_byte(dev, 0x00);
-	spi_master_write_command(dev, 0xC0);    // ILI:Power Control 1 (C0h), ST:LCMCTRL (C0h): LCM Control
-	spi_master_write_data_byte(dev, 0x1B);
-	spi_master_write_command(dev, 0xC1);    // ILI:Power Control 2 (C1h), ST:IDSET (C1h): ID Code Setting
-	spi_master_write_data_byte(dev, 0x12);
-	spi_master_write_command(dev, 0xC5);    // ILI:VCOM Control 1(C5h), ST:VCMOFSET (C5h): VCOM Offset Set
-	spi_master_write_data_byte(dev, 0x32);
-	spi_master_write_data_byte(dev, 0x3C);
-	spi_master_write_command(dev, 0xC7);    // ILI:VCOM Control 2(C7h), ST:CABCCTRL (C7h): CABC Control
-	spi_master_write_data_byte(dev, 0x91);
-	spi_master_write_command(dev, 0xB1);    // ILI:Frame Rate Control (In Normal Mode/Full Colors) (B1h), ST:RGBCTRL (B1h): RGB Interface Control
-	spi_master_write_data_byte(dev, 0x00);
-	spi_master_write_data_byte(dev, 0x10);
-	spi_master_write_command(dev, 0xB6);    // ILI:Display Function Control (B6h), ILI9341 only
-	spi_master_write_data_byte(dev, 0x0A);
-	spi_master_write_data_byte(dev, 0xA2);
-	spi_master_write_command(dev, 0xF6);    // ILI:Interface Control (F6h), ILI9341 only
-	spi_master_write_data_byte(dev, 0x01);
-	spi_master_write_data_byte(dev, 0x30);
-
-	spi_master_write_command(dev, 0x11);    // ILI:Sleep Out (11h), ST:SLPOUT (11h): Sleep Out
-	delayMS(5);
-
-#elif LCD_DRIVER == 1
-
-	// spi_master_write_command(dev, 0x01);  // SWRESET (01h): Software Reset
-	// delayMS(5);
-
-	spi_master_write_command(dev, 0x36);  // MADCTL (36h): Memory Data Access Control
-	spi_master_write_data_byte(dev, 0x00);
-
-	spi_master_write_command(dev, 0x3A);  // COLMOD (3Ah): Interface Pixel Format
-	spi_master_write_data_byte(dev, 0x05);
-
-	spi_master_write_command(dev, 0xB2);  // PORCTRL (B2h): Porch Setting
-	spi_master_write_data_byte(dev, 0x0C);
-	spi_master_write_data_byte(dev, 0x0C);
-	spi_master_write_data_byte(dev, 0x00);
-	spi_master_write_data_byte(dev, 0x33);
-	spi_master_write_data_byte(dev, 0x33);
-
-	spi_master_write_command(dev, 0xB7);  // GCTRL (B7h): Gate Control
-	spi_master_write_data_byte(dev, 0x35);
-
-	spi_master_write_command(dev, 0xBB);  // VCOMS (BBh): VCOM Setting
-	spi_master_write_data_byte(dev, 0x19);
-
-	spi_master_write_command(dev, 0xC0);  // LCMCTRL (C0h): LCM Control
-	spi_master_write_data_byte(dev, 0x2C);
-
-	spi_master_write_command(dev, 0xC2);  // VDVVRHEN (C2h): VDV and VRH Command Enable
-	spi_master_write_data_byte(dev, 0x01);
-
-	spi_master_write_command(dev, 0xC3);  // VRHS (C3h): VRH Set
-	spi_master_write_data_byte(dev, 0x12);
-
-	spi_master_write_command(dev, 0xC4);  // VDVS (C4h): VDV Set
-	spi_master_write_data_byte(dev, 0x20);
-
-	spi_master_write_command(dev, 0xC6);  // FRCTRL2 (C6h): Frame Rate Control in Normal Mode
-	spi_master_write_data_byte(dev, 0x0F);
-
-	spi_master_write_command(dev, 0xD0);  // PWCTRL1 (D0h): Power Control 1
-	spi_master_write_data_byte(dev, 0xA4);
-	spi_master_write_data_byte(dev, 0xA1);
-
-	spi_master_write_command(dev, 0xE0);  // PVGAMCTRL (E0h): Positive Voltage Gamma Control
-	spi_master_write_data_byte(dev, 0xD0);
-	spi_master_write_data_byte(dev, 0x04);
-	spi_master_write_data_byte(dev, 0x0D);
-	spi_master_write_data_byte(dev, 0x11);
-	spi_master_write_data_byte(dev, 0x13);
-	spi_master_write_data_byte(dev, 0x2B);
-	spi_master_write_data_byte(dev, 0x3F);
-	spi_master_write_data_byte(dev, 0x54);
-	spi_master_write_data_byte(dev, 0x4C);
-	spi_master_write_data_byte(dev, 0x18);
-	spi_master_write_data_byte(dev, 0x0D);
-	spi_master_write_data_byte(dev, 0x0B);
-	spi_master_write_data_byte(dev, 0x1F);
-	spi_master_write_data_byte(dev, 0x23);
-
-	spi_master_write_command(dev, 0xE1);  // NVGAMCTRL (E1h): Negative Voltage Gamma Control
-	spi_master_write_data_byte(dev, 0xD0);
-	spi_master_write_data_byte(dev, 0x04);
-	spi_master_write_data_byte(dev, 0x0C);
-	spi_master_write_data_byte(dev, 0x11);
-	spi_master_write_data_byte(dev, 0x13);
-	spi_master_write_data_byte(dev, 0x2C);
-	spi_master_write_data_byte(dev, 0x3F);
-	spi_master_write_data_byte(dev, 0x44);
-	spi_master_write_data_byte(dev, 0x51);
-	spi_master_write_data_byte(dev, 0x2F);
-	spi_master_write_data_byte(dev, 0x1F);
-	spi_master_write_data_byte(dev, 0x1F);
-	spi_master_write_data_byte(dev, 0x20);
-	spi_master_write_data_byte(dev, 0x23);
-
-	spi_master_write_command(dev, 0x11);  // SLPOUT (11h): Sleep Out
-	delayMS(5);
-
+	// Configure while the reset window runs out, then sleep out.
+	lcd_runInitTable(init_cmds, sizeof(init_cmds), t_reset);
+#if LCD_DIR
+	lcd_setRotation(LCD_DIR);
 #endif
 
-#if LCD_INV
-	ESP_LOGI(TAG, "Enable Display Inversion");
-	lcd_inversionOn();
-#else
-	lcd_inversionOff();
-#endif
 	lcd_fillScreen(BLACK); // assume use_frame_buffer is false
 	lcd_displayOn();
 	lcd_backlightOn();
+	init_us = esp_timer_get_time() - t_init;
+	first_frame_us = 0;
+	ESP_LOGI(TAG, "display on %lld us after lcd_init()", (long long)init_us);
+}
+
+int64_t lcd_initTime(void)
+{
+	return init_us;
+}
+
+int64_t lcd_firstFrameTime(void)
+{
+	return first_frame_us;
 }
 
 //----------------------------------------------------------------------------//
@@ -654,6 +655,106 @@ void lcd_fillRect(coord_t x, coord_t y, coord_t w, coord_t h, color_t color)
 	}
 }
 
+// 4x4 Bayer matrix, as thresholds (B+0.5)/16 in 1/256 units.
+static const uint8_t bayer4[4][4] = {
+	{  8, 136,  40, 168},
+	{200,  72, 232, 104},
+	{ 56, 184,  24, 152},
+	{248, 120, 216,  88},
+};
+
+// Channel levels of a 0xRRGGBB color in 16.16 fixed point units of the
+// RGB565 step (31 or 63 levels full scale).
+static inline void grad_levels(uint32_t rgb, int32_t lv[3])
+{
+	lv[0] = (int32_t)(((rgb >> 16) & 0xFF) * (31 << 16) / 255);
+	lv[1] = (int32_t)(((rgb >>  8) & 0xFF) * (63 << 16) / 255);
+	lv[2] = (int32_t)(( rgb        & 0xFF) * (31 << 16) / 255);
+}
+
+// Quantize levels to RGB565, rounding up when the fraction is above t.
+static inline color_t grad_dither(const int32_t lv[3], uint32_t t)
+{
+	int32_t r = ((lv[0] >> 8) + t) >> 8;
+	int32_t g = ((lv[1] >> 8) + t) >> 8;
+	int32_t b = ((lv[2] >> 8) + t) >> 8;
+	if (r > 31) r = 31;
+	if (g > 63) g = 63;
+	if (b > 31) b = 31;
+	return (r << 11) | (g << 5) | b;
+}
+
+/**
+ * @details The dither pattern is anchored to the screen, so adjacent
+ *  gradient fills line up. A vertical gradient has one color per row, so
+ *  each row is a repeating run of 4 precomputed pixels. A horizontal
+ *  gradient repeats every 4 rows, so only 4 rows are computed and the rest
+ *  are copied (frame buffer) or regenerated per row (SPI).
+ */
+void lcd_fillRectGradient(coord_t x, coord_t y, coord_t w, coord_t h, uint32_t rgb0, uint32_t rgb1, bool vertical)
+{
+	if (x+w <= 0 || x >= dev->width || w <= 0) return; // off screen
+	if (y+h <= 0 || y >= dev->height || h <= 0) return;
+
+	int32_t lv0[3], lv1[3], step[3];
+	coord_t n = vertical ? h : w; // gradient length
+	grad_levels(rgb0, lv0);
+	grad_levels(rgb1, lv1);
+	for (uint32_t c = 0; c < 3; c++) step[c] = (n > 1) ? (lv1[c]-lv0[c]) / (n-1) : 0;
+
+	coord_t x0 = x, y0 = y; // gradient origin before clipping
+	if (x < 0) {w += x; x = 0;} // clip
+	if (y < 0) {h += y; y = 0;}
+	if (x+w > dev->width) w = dev->width-x;
+	if (y+h > dev->height) h = dev->height-y;
+
+	color_t *fb = dev->use_frame_buffer ? dev->frame_buffer + (size_t)y*dev->width + x : NULL;
+	size_t nb = 0;
+	if (fb == NULL) {
+		coord_t _x1 = x + dev->offsetx;
+		coord_t _y1 = y + dev->offsety;
+		spi_master_write_command(dev, 0x2A); // Column(x) Address Set
+		spi_master_write_addr(dev, _x1, _x1+w-1);
+		spi_master_write_command(dev, 0x2B); // Page(y) Address Set
+		spi_master_write_addr(dev, _y1, _y1+h-1);
+		spi_master_write_command(dev, 0x2C); // Memory Write
+		gpio_set_level(dev->dc, SPI_Data_Mode);
+	}
+	for (coord_t j = 0; j < h; j++) {
+		const uint8_t *thr = bayer4[(y+j) & 3];
+		color_t pat[4];
+		if (fb && !vertical && j >= 4) { // same as 4 rows up
+			memcpy(fb, fb - 4*dev->width, w*sizeof(color_t));
+			fb += dev->width;
+			continue;
+		}
+		int32_t lv[3];
+		coord_t i0 = vertical ? y+j-y0 : x-x0;
+		for (uint32_t c = 0; c < 3; c++) lv[c] = lv0[c] + step[c]*i0;
+		if (vertical) {
+			for (uint32_t k = 0; k < 4; k++) pat[k] = grad_dither(lv, thr[k]);
+		}
+		for (coord_t i = 0; i < w; i++) {
+			color_t color;
+			if (vertical) color = pat[(x+i) & 3];
+			else {
+				color = grad_dither(lv, thr[(x+i) & 3]);
+				lv[0] += step[0]; lv[1] += step[1]; lv[2] += step[2];
+			}
+			if (fb) fb[i] = color;
+			else {
+				buffer[nb++] = SWAP16(color);
+				if (nb == BUF_LEN) {
+					spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, nb*sizeof(uint16_t));
+					nb = 0;
+				}
+			}
+		}
+		if (fb) fb += dev->width;
+	}
+	if (nb) spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, nb*sizeof(uint16_t));
+}
+
 void lcd_drawTriangle(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t x2, coord_t y2, color_t color)
 {
 	lcd_drawLine(x0, y0, x1, y1, color);
@@ -891,33 +992,257 @@ void lcd_fillArrow(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t w, co
 	lcd_fillTriangle(x1, y1, L[0], L[1], R[0], R[1], color);
 }
 
-void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color)
+// Expansion masks for 1-bit images: bit_mask[b][i] is 0xFFFF if bit (7-i)
+// of byte b is set, otherwise 0x0000. Each source byte becomes 8 pixels
+// with a select operation and no per-bit branches.
+#define BM1(b) ((b) ? 0xFFFF : 0x0000)
+#define BM8(n) {BM1((n)&0x80),BM1((n)&0x40),BM1((n)&0x20),BM1((n)&0x10), \
+                BM1((n)&0x08),BM1((n)&0x04),BM1((n)&0x02),BM1((n)&0x01)}
+#define BM32(n) BM8(n),BM8(n+1),BM8(n+2),BM8(n+3),BM8(n+4),BM8(n+5),BM8(n+6),BM8(n+7), \
+	BM8(n+8),BM8(n+9),BM8(n+10),BM8(n+11),BM8(n+12),BM8(n+13),BM8(n+14),BM8(n+15), \
+	BM8(n+16),BM8(n+17),BM8(n+18),BM8(n+19),BM8(n+20),BM8(n+21),BM8(n+22),BM8(n+23), \
+	BM8(n+24),BM8(n+25),BM8(n+26),BM8(n+27),BM8(n+28),BM8(n+29),BM8(n+30),BM8(n+31)
+
+static const uint16_t bit_mask[256][8] = {
+	BM32(0), BM32(32), BM32(64), BM32(96), BM32(128), BM32(160), BM32(192), BM32(224)
+};
+
+// Expand n bits of a 1-bit image row, starting at bit offset skip, into
+// pixels at dst. Set bits become color. Unset bits become back if opaque,
+// otherwise the destination pixel is unchanged.
+static void expand_1bpp(color_t *dst, const uint8_t *src, coord_t skip, coord_t n, color_t color, color_t back, bool opaque)
 {
-	coord_t byteWidth = (w + 7) / 8; // pad bitmap scanline to whole byte
-	uint8_t b = 0;
+	coord_t bit = skip & 7;
+	src += skip >> 3;
+	if (opaque) {
+		color_t diff = back ^ color;
+		while (n) {
+			const uint16_t *m = bit_mask[*src++] + bit;
+			coord_t k = 8 - bit;
+			if (k > n) k = n;
+			n -= k; bit = 0;
+			while (k--) *dst++ = back ^ (diff & *m++);
+		}
+	} else {
+		while (n) {
+			uint8_t b = *src++;
+			const uint16_t *m = bit_mask[b] + bit;
+			coord_t k = 8 - bit;
+			if (k > n) k = n;
+			n -= k; bit = 0;
+			if (b == 0) {dst += k; continue;} // all transparent
+			while (k--) {*dst ^= (*dst ^ color) & *m++; dst++;}
+		}
+	}
+}
 
+// Draw a 1-bit image with stride bytes per row. Rows are expanded directly
+// into the frame buffer, or into a DMA chunk streamed to the display.
+static void draw_1bpp(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, coord_t stride, color_t color, color_t back, bool opaque)
+{
 	if (x+w <= 0 || x >= dev->width) return; // off screen
 	if (y+h <= 0 || y >= dev->height) return;
 
-	for (size_t j = 0; j < h; j++, y++) {
-		for (size_t i = 0; i < w; i++) {
-			if (i & 7) b <<= 1;
-			else b = bitmap[j * byteWidth + i / 8];
-			if (b & 0x80) lcd_drawPixel(x + i, y, color);
+	coord_t skip = (x < 0) ? -x : 0; // clip
+	coord_t row = (y < 0) ? -y : 0;
+	coord_t n = ((x+w > dev->width) ? dev->width-x : w) - skip;
+	coord_t rows = ((y+h > dev->height) ? dev->height-y : h) - row;
+	const uint8_t *src = bitmap + row*stride;
+	x += skip;
+	y += row;
+
+	if (dev->use_frame_buffer) {
+		color_t *dst = dev->frame_buffer + (size_t)y*dev->width + x;
+		for (; rows; rows--, src += stride, dst += dev->width) {
+			expand_1bpp(dst, src, skip, n, color, back, opaque);
+		}
+	} else if (opaque) {
+		coord_t _x1 = x + dev->offsetx;
+		coord_t _y1 = y + dev->offsety;
+
+		spi_master_write_command(dev, 0x2A); // Column(x) Address Set
+		spi_master_write_addr(dev, _x1, _x1+n-1);
+		spi_master_write_command(dev, 0x2B); // Page(y) Address Set
+		spi_master_write_addr(dev, _y1, _y1+rows-1);
+		spi_master_write_command(dev, 0x2C); // Memory Write
+		gpio_set_level(dev->dc, SPI_Data_Mode);
+		size_t len = 0; // pixels in chunk
+		for (; rows; rows--, src += stride) {
+			if (len+n > BUF_LEN) {
+				spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, len*sizeof(uint16_t));
+				len = 0;
+			}
+			// Colors are byte swapped up front, so the chunk is ready to send.
+			expand_1bpp(buffer+len, src, skip, n, SWAP16(color), SWAP16(back), true);
+			len += n;
+		}
+		spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, len*sizeof(uint16_t));
+	} else {
+		// Without a frame buffer, draw each run of set bits as one line.
+		for (; rows; rows--, src += stride, y++) {
+			coord_t start = -1;
+			for (coord_t i = 0; i <= n; i++) {
+				coord_t b = i + skip;
+				bool set = (i < n) && (src[b >> 3] & (0x80 >> (b & 7)));
+				if (set && start < 0) start = i;
+				else if (!set && start >= 0) {
+					lcd_drawHLine(x+start, y, i-start, color);
+					start = -1;
+				}
+			}
 		}
 	}
 }
 
+void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color)
+{
+	draw_1bpp(x, y, bitmap, w, h, (w + 7) / 8, color, color, false);
+}
+
+void lcd_drawBitmapBg(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t back)
+{
+	draw_1bpp(x, y, bitmap, w, h, (w + 7) / 8, color, back, true);
+}
+
+// Without a frame buffer, the clipped image is sent through one address
+// window, packing rows into the line buffer.
 void lcd_drawRGBBitmap(coord_t x, coord_t y, const color_t *bitmap, coord_t w, coord_t h)
 {
 	if (x+w <= 0 || x >= dev->width) return; // off screen
 	if (y+h <= 0 || y >= dev->height) return;
 
-	for (size_t j = 0; j < h; j++, y++) {
-		lcd_drawHPixels(x, y, w, bitmap+j*w);
+	coord_t stride = w;
+	if (x < 0) {bitmap -= x; w += x; x = 0;} // clip
+	if (y < 0) {bitmap -= (size_t)y*stride; h += y; y = 0;}
+	if (x+w > dev->width) w = dev->width-x;
+	if (y+h > dev->height) h = dev->height-y;
+
+	if (dev->use_frame_buffer) {
+		color_t *fb = dev->frame_buffer + (size_t)y*dev->width + x;
+		for (coord_t j = 0; j < h; j++, fb += dev->width, bitmap += stride) {
+			memcpy(fb, bitmap, w*sizeof(color_t));
+		}
+	} else {
+		coord_t _x1 = x + dev->offsetx;
+		coord_t _y1 = y + dev->offsety;
+		size_t n = 0;
+
+		spi_master_write_command(dev, 0x2A); // Column(x) Address Set
+		spi_master_write_addr(dev, _x1, _x1+w-1);
+		spi_master_write_command(dev, 0x2B); // Page(y) Address Set
+		spi_master_write_addr(dev, _y1, _y1+h-1);
+		spi_master_write_command(dev, 0x2C); // Memory Write
+		gpio_set_level(dev->dc, SPI_Data_Mode);
+		for (coord_t j = 0; j < h; j++, bitmap += stride) {
+			for (coord_t i = 0; i < w; i++) {
+				buffer[n++] = SWAP16(bitmap[i]);
+				if (n == BUF_LEN) {
+					spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, n*sizeof(uint16_t));
+					n = 0;
+				}
+			}
+		}
+		if (n) spi_master_write_bytes(dev->SPIHandle, (uint8_t *)buffer, n*sizeof(uint16_t));
 	}
 }
 
+// Polygon edge for the scanline filler. X is 16.16 fixed point.
+typedef struct {
+	coord_t ytop; // first scanline crossed
+	coord_t ybot; // scanline after the last one crossed
+	int32_t x;    // X at the center of the current scanline
+	int32_t dxdy; // X step per scanline
+	int8_t  dir;  // winding direction, +1 down, -1 up
+} edge_t;
+
+#define FP_SHIFT 16
+#define FP_HALF (1 << (FP_SHIFT-1))
+
+/**
+ * @details Scanline conversion with an active edge table. Edges are
+ *  sampled at pixel centers, so polygons sharing an edge do not overlap.
+ *  Spans are written straight into the frame buffer when it is enabled.
+ */
+void lcd_fillPolygon(const point_t *points, coord_t n, color_t color)
+{
+	if (n < 3) return;
+
+	edge_t et[n]; // edge table, sorted by ytop
+	edge_t *aet[n]; // active edge table, sorted by x
+	coord_t ne = 0, na = 0;
+	coord_t ymin = points[0].y, ymax = points[0].y;
+
+	for (coord_t i = 0; i < n; i++) {
+		const point_t *p0 = &points[i];
+		const point_t *p1 = &points[(i+1 < n) ? i+1 : 0];
+		if (p0->y < ymin) ymin = p0->y;
+		if (p0->y > ymax) ymax = p0->y;
+		if (p0->y == p1->y) continue; // horizontal edges add no crossings
+		int8_t dir = 1;
+		if (p0->y > p1->y) {swap(const point_t *, p0, p1); dir = -1;}
+		edge_t e = {
+			.ytop = p0->y,
+			.ybot = p1->y,
+			.dxdy = (int32_t)(((int64_t)(p1->x - p0->x) << FP_SHIFT) / (p1->y - p0->y)),
+			.dir = dir,
+		};
+		e.x = ((int32_t)p0->x << FP_SHIFT) + e.dxdy/2;
+		coord_t j = ne++; // insertion sort by ytop
+		for (; j > 0 && et[j-1].ytop > e.ytop; j--) et[j] = et[j-1];
+		et[j] = e;
+	}
+
+	if (ymax <= 0 || ymin >= dev->height) return; // off screen
+	coord_t y = (ymin < 0) ? 0 : ymin; // clip
+	if (ymax > dev->height) ymax = dev->height;
+
+	for (coord_t next = 0; y < ymax; y++) {
+		// Add edges that start on or above this scanline.
+		for (; next < ne && et[next].ytop <= y; next++) {
+			edge_t *e = &et[next];
+			if (e->ybot <= y) continue; // ends above the clip region
+			if (e->ytop < y) e->x += (int32_t)((int64_t)e->dxdy * (y - e->ytop));
+			aet[na++] = e;
+		}
+		// Remove finished edges and keep the rest sorted by x. The order
+		// changes little between scanlines, so insertion sort is cheap.
+		coord_t k = 0;
+		for (coord_t i = 0; i < na; i++) {
+			edge_t *e = aet[i];
+			if (e->ybot <= y) continue;
+			coord_t j = k++;
+			for (; j > 0 && aet[j-1]->x > e->x; j--) aet[j] = aet[j-1];
+			aet[j] = e;
+		}
+		na = k;
+
+		// Fill spans between crossings according to the fill rule.
+		int32_t wind = 0;
+		for (coord_t i = 0; i+1 < na; i++) {
+			wind += (dev->fill_rule == FILL_NON_ZERO) ? aet[i]->dir : 1;
+			bool inside = (dev->fill_rule == FILL_NON_ZERO) ? wind != 0 : (wind & 1);
+			if (!inside) continue;
+			coord_t x0 = (aet[i]->x + FP_HALF - 1) >> FP_SHIFT;
+			coord_t x1 = (aet[i+1]->x + FP_HALF - 1) >> FP_SHIFT; // exclusive
+			if (x0 < 0) x0 = 0; // clip
+			if (x1 > dev->width) x1 = dev->width;
+			if (x0 >= x1) continue;
+			if (dev->use_frame_buffer) {
+				color_t *ptr = dev->frame_buffer + (size_t)y*dev->width;
+				for (coord_t x = x0; x < x1; x++) ptr[x] = color;
+			} else {
+				lcd_drawHLine(x0, y, x1-x0, color);
+			}
+		}
+		for (coord_t i = 0; i < na; i++) aet[i]->x += aet[i]->dxdy;
+	}
+}
+
+void lcd_setFillRule(fill_rule_t rule)
+{
+	dev->fill_rule = rule;
+}
+
 //----------------------------------------------------------------------------//
 // Rectangle variants that specify two diagonal corners
 //----------------------------------------------------------------------------//
@@ -1134,55 +1459,131 @@ void lcd_drawRegularPolygonC(coord_t xc, coord_t yc, coord_t n, coord_t r, angle
 	}
 }
 
+/**
+ * @details Vertices are placed as in lcd_drawRegularPolygonC() and the
+ *  interior is filled with lcd_fillPolygon().
+ */
+void lcd_fillRegularPolygonC(coord_t xc, coord_t yc, coord_t n, coord_t r, angle_t angle, color_t color)
+{
+	float xd, yd, rd;
+
+	if (n < 3) return;
+	point_t pts[n];
+	rd = -angle * M_PIf / 180.0f; // degrees to radians
+	for (coord_t i = 0; i < n; i++) {
+		xd = r * cosf(2 * M_PIf * i / n);
+		yd = r * sinf(2 * M_PIf * i / n);
+		pts[i].x = (coord_t)(xd * cosf(rd) - yd * sinf(rd) + xc);
+		pts[i].y = (coord_t)(xd * sinf(rd) + yd * cosf(rd) + yc);
+	}
+	lcd_fillPolygon(pts, n, color);
+}
+
+/**
+ * @details Each screen pixel in the bounding box is mapped back into the
+ *  sprite (inverse rotation and scale) in 16.16 fixed point. The sprite
+ *  coordinates step by a constant per pixel and per scanline, so the inner
+ *  loop only has adds, shifts and a bounds check.
+ * u = ( dx * cos(angle) + dy * sin(angle)) / scale + w/2
+ * v = (-dx * sin(angle) + dy * cos(angle)) / scale + h/2
+ */
+void lcd_drawSpriteTransformed(coord_t xc, coord_t yc, const color_t *sprite, coord_t w, coord_t h, int32_t scale, angle_t angle, bool flip)
+{
+	if (scale <= 0 || w <= 0 || h <= 0) return;
+
+	float rd = -angle * M_PIf / 180.0f; // degrees to radians
+	float c = cosf(rd), s = sinf(rd);
+	float sf = (float)scale / LCD_SCALE_ONE;
+
+	// Bounding box of the transformed sprite.
+	float hw = w * sf / 2, hh = h * sf / 2;
+	coord_t bw = (coord_t)(fabsf(hw * c) + fabsf(hh * s) + 1.0f);
+	coord_t bh = (coord_t)(fabsf(hw * s) + fabsf(hh * c) + 1.0f);
+	coord_t x0 = xc - bw, x1 = xc + bw;
+	coord_t y0 = yc - bh, y1 = yc + bh;
+	if (x1 < 0 || x0 >= dev->width) return; // off screen
+	if (y1 < 0 || y0 >= dev->height) return;
+	if (x0 < 0) x0 = 0; // clip
+	if (x1 >= dev->width) x1 = dev->width-1;
+	if (y0 < 0) y0 = 0;
+	if (y1 >= dev->height) y1 = dev->height-1;
+
+	// Sprite steps per screen pixel in X and per scanline in Y.
+	int32_t dudx = (int32_t)(c / sf * (1 << FP_SHIFT));
+	int32_t dvdx = (int32_t)(-s / sf * (1 << FP_SHIFT));
+	int32_t dudy = (int32_t)(s / sf * (1 << FP_SHIFT));
+	int32_t dvdy = (int32_t)(c / sf * (1 << FP_SHIFT));
+	if (flip) {dudx = -dudx; dudy = -dudy;}
+
+	// Sprite coordinates at the center of the first pixel.
+	int32_t dx2 = 2*(x0-xc)+1, dy2 = 2*(y0-yc)+1; // doubled, half pixel
+	int32_t ur = (int32_t)(((int64_t)dudx*dx2 + (int64_t)dudy*dy2) / 2) + (w << (FP_SHIFT-1));
+	int32_t vr = (int32_t)(((int64_t)dvdx*dx2 + (int64_t)dvdy*dy2) / 2) + (h << (FP_SHIFT-1));
+
+	coord_t n = x1-x0+1;
+	color_t run[n];
+	for (coord_t y = y0; y <= y1; y++, ur += dudy, vr += dvdy) {
+		int32_t u = ur, v = vr;
+		color_t *dst = dev->use_frame_buffer ?
+			dev->frame_buffer + (size_t)y*dev->width + x0 : NULL;
+		coord_t len = 0; // length of opaque run (direct mode)
+		for (coord_t i = 0; i < n; i++, u += dudx, v += dvdx) {
+			uint32_t iu = (uint32_t)(u >> FP_SHIFT);
+			uint32_t iv = (uint32_t)(v >> FP_SHIFT);
+			color_t pixel = LCD_TRANSPARENT;
+			if (iu < (uint32_t)w && iv < (uint32_t)h) pixel = sprite[iv*w+iu];
+			if (dst) {
+				if (pixel != LCD_TRANSPARENT) dst[i] = pixel;
+			} else if (pixel != LCD_TRANSPARENT) {
+				run[len++] = pixel;
+			} else if (len) {
+				lcd_drawHPixels(x0+i-len, y, len, run);
+				len = 0;
+			}
+		}
+		if (len) lcd_drawHPixels(x0+n-len, y, len, run);
+	}
+}
+
 //----------------------------------------------------------------------------//
 // Draw characters and strings
 //----------------------------------------------------------------------------//
 
 coord_t lcd_drawChar(coord_t x, coord_t y, char ascii, color_t color)
 {
-#if 0
-	if ((x >= dev->width) ||                        // off screen right
-		(y >= dev->height) ||                       // off screen bottom
-		((x + LCD_CHAR_W * dev->font_size) <= 0) || // off screen left
-		((y + LCD_CHAR_H * dev->font_size) <= 0))   // off screen top
-		return;
-#endif
-
-	if (dev->font_back_en) {
-		lcd_fillRect(x, y,
-			LCD_CHAR_W*dev->font_size,
-			LCD_CHAR_H*dev->font_size,
-			dev->font_back_color);
+	uint8_t rows[LCD_CHAR_H];
+	const uint8_t *glyph = &font[(uint8_t)ascii * (LCD_CHAR_W-1)];
+	coord_t size = dev->font_size;
+
+	// Font columns are stored LSB at top. Transpose into MSB first rows
+	// (last column is blank spacing) so the 1-bit image kernel can be used.
+	for (int8_t j = 0; j < LCD_CHAR_H; j++) {
+		uint8_t b = 0;
+		for (int8_t i = 0; i < LCD_CHAR_W-1; i++) {
+			b |= ((glyph[i] >> j) & 0x1) << (7-i);
+		}
+		rows[j] = b;
 	}
-	for (int8_t i = 0; i < LCD_CHAR_W; i++) {
-		uint8_t line;
-		if (i == LCD_CHAR_W-1)
-			line = 0x0;
-		else
-			line = font[((uint8_t)ascii * (LCD_CHAR_W-1)) + i];
+
+	if (size == 1) { // default size
+		draw_1bpp(x, y, rows, LCD_CHAR_W, LCD_CHAR_H, 1,
+			color, dev->font_back_color, dev->font_back_en);
+	} else { // big size, one block per run of set bits
+		if (dev->font_back_en) {
+			lcd_fillRect(x, y, LCD_CHAR_W*size, LCD_CHAR_H*size, dev->font_back_color);
+		}
 		for (int8_t j = 0; j < LCD_CHAR_H; j++) {
-			if (line & 0x1) {
-				if (dev->font_size == 1) // default size
-					lcd_drawPixel(x + i, y + j, color);
-				else { // big size
-					coord_t x1 = x + (i * dev->font_size), y1 = y + (j * dev->font_size);
-					lcd_fillRect(x1, y1, dev->font_size, dev->font_size, color);
-				}
+			uint8_t b = rows[j];
+			int8_t i = 0;
+			while (b) {
+				if (!(b & 0x80)) {b <<= 1; i++; continue;}
+				int8_t start = i;
+				while (b & 0x80) {b <<= 1; i++;}
+				lcd_fillRect(x + start*size, y + j*size, (i-start)*size, size, color);
 			}
-#if 0
-			else if (dev->font_back_en) {
-				if (dev->font_size == 1) // default size
-					lcd_drawPixel(x + i, y + j, dev->font_back_color);
-				else { // big size
-					coord_t x1 = x + (i * dev->font_size), y1 = y + (j * dev->font_size);
-					lcd_fillRect(x1, y1, dev->font_size, dev->font_size, dev->font_back_color);
-				}
-			}
-#endif
-			line >>= 1;
 		}
 	}
-	return x+LCD_CHAR_W*dev->font_size;
+	return x+LCD_CHAR_W*size;
 }
 
 coord_t lcd_drawString(coord_t x, coord_t y, const char *ascii, color_t color)
@@ -1194,6 +1595,102 @@ coord_t lcd_drawString(coord_t x, coord_t y, const char *ascii, color_t color)
 	return x;
 }
 
+#define NUM_BUF_LEN 16 // sign, 10 digits, leading zero and decimal point
+#define NUM_FRAC_MAX 9
+
+// Convert value (scaled by 10^frac) to decimal characters that end at
+// buf[NUM_BUF_LEN-1]. Returns a pointer to the first character.
+static char *lcd_numToChars(char *buf, int32_t value, uint8_t frac)
+{
+	char *p = buf + NUM_BUF_LEN;
+	uint32_t mag = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+
+	if (frac > NUM_FRAC_MAX) frac = NUM_FRAC_MAX;
+	for (uint8_t i = 0; i < frac; i++) {
+		*--p = '0' + mag % 10;
+		mag /= 10;
+	}
+	if (frac) *--p = '.';
+	do {
+		*--p = '0' + mag % 10;
+		mag /= 10;
+	} while (mag);
+	if (value < 0) *--p = '-';
+	return p;
+}
+
+coord_t lcd_drawInt(coord_t x, coord_t y, int32_t value, color_t color)
+{
+	return lcd_drawFixed(x, y, value, 0, color);
+}
+
+coord_t lcd_drawFixed(coord_t x, coord_t y, int32_t value, uint8_t frac, color_t color)
+{
+	char buf[NUM_BUF_LEN];
+	char *end = buf + NUM_BUF_LEN;
+	for (char *p = lcd_numToChars(buf, value, frac); p < end; p++) {
+		x = lcd_drawChar(x, y, *p, color);
+	}
+	return x;
+}
+
+//----------------------------------------------------------------------------//
+// Fixed-width numeric fields for HUD counters
+//----------------------------------------------------------------------------//
+
+void lcd_fieldInit(lcd_field_t *field, coord_t x, coord_t y, uint8_t width, uint8_t frac, color_t color, color_t back)
+{
+	if (width < 1) width = 1;
+	if (width > LCD_FIELD_MAX) width = LCD_FIELD_MAX;
+	field->x = x;
+	field->y = y;
+	field->width = width;
+	field->frac = frac;
+	field->color = color;
+	field->back = back;
+	lcd_fieldInvalidate(field);
+}
+
+void lcd_fieldUpdate(lcd_field_t *field, int32_t value)
+{
+	char buf[NUM_BUF_LEN];
+	char text[LCD_FIELD_MAX];
+	char *p = lcd_numToChars(buf, value, field->frac);
+	size_t len = buf + NUM_BUF_LEN - p;
+	size_t width = field->width;
+
+	// Right align, or mark the field if the value does not fit.
+	if (len > width) {
+		memset(text, '#', width);
+	} else {
+		memset(text, ' ', width-len);
+		memcpy(text+width-len, p, len);
+	}
+
+	if (field->size != dev->font_size) {
+		lcd_fieldInvalidate(field);
+		field->size = dev->font_size;
+	}
+	coord_t cw = LCD_CHAR_W * field->size;
+	coord_t ch = LCD_CHAR_H * field->size;
+	bool back_en = dev->font_back_en;
+	dev->font_back_en = false; // cell is cleared with the field background
+	for (size_t i = 0; i < width; i++) {
+		if (text[i] == field->text[i]) continue; // unchanged
+		coord_t xc = field->x + i * cw;
+		lcd_fillRect(xc, field->y, cw, ch, field->back);
+		if (text[i] != ' ') lcd_drawChar(xc, field->y, text[i], field->color);
+		field->text[i] = text[i];
+	}
+	dev->font_back_en = back_en;
+}
+
+void lcd_fieldInvalidate(lcd_field_t *field)
+{
+	memset(field->text, 0, sizeof(field->text)); // never matches a character
+	field->size = 0;
+}
+
 //----------------------------------------------------------------------------//
 // Font parameters
 //----------------------------------------------------------------------------//
@@ -1225,6 +1722,63 @@ void lcd_noFontBackground(void)
 // Display configuration
 //----------------------------------------------------------------------------//
 
+void lcd_setRotation(direction_t rot)
+{
+	static const uint8_t madctl[] = {
+		MADCTL_BASE,
+		MADCTL_BASE | MADCTL_MV | MADCTL_MX,
+		MADCTL_BASE | MADCTL_MX | MADCTL_MY,
+		MADCTL_BASE | MADCTL_MV | MADCTL_MY,
+	};
+
+	rot &= 3;
+	// With MV set, MX mirrors the logical y axis and MY the logical x axis.
+	switch (rot) {
+	case DIRECTION0:
+		dev->width = LCD_W;
+		dev->height = LCD_H;
+		dev->offsetx = LCD_OFFSETX;
+		dev->offsety = LCD_OFFSETY;
+		break;
+	case DIRECTION90:
+		dev->width = LCD_H;
+		dev->height = LCD_W;
+		dev->offsetx = LCD_OFFSETY;
+		dev->offsety = LCD_RAM_W - LCD_W - LCD_OFFSETX;
+		break;
+	case DIRECTION180:
+		dev->width = LCD_W;
+		dev->height = LCD_H;
+		dev->offsetx = LCD_RAM_W - LCD_W - LCD_OFFSETX;
+		dev->offsety = LCD_RAM_H - LCD_H - LCD_OFFSETY;
+		break;
+	case DIRECTION270:
+		dev->width = LCD_H;
+		dev->height = LCD_W;
+		dev->offsetx = LCD_RAM_H - LCD_H - LCD_OFFSETY;
+		dev->offsety = LCD_OFFSETX;
+		break;
+	}
+	dev->rotation = rot;
+	spi_master_write_command(dev, 0x36); // ILI:Memory Access Control (36h), ST:MADCTL (36h)
+	spi_master_write_data_byte(dev, madctl[rot]);
+}
+
+direction_t lcd_getRotation(void)
+{
+	return dev->rotation;
+}
+
+coord_t lcd_getWidth(void)
+{
+	return dev->width;
+}
+
+coord_t lcd_getHeight(void)
+{
+	return dev->height;
+}
+
 void lcd_spiClockFreq(int32_t freq)
 {
 	ESP_LOGI(TAG, "SPI clock frequency=%d MHz", (int)freq/1000000);
@@ -1362,6 +1916,10 @@ void lcd_writeFrame(void)
 	spi_master_write_addr(dev, dev->offsety, dev->offsety+dev->height-1);
 	spi_master_write_command(dev, 0x2C); // Memory Write
 	spi_master_write_colors(dev, dev->frame_buffer, dev->width*dev->height);
+	if (!first_frame_us) {
+		first_frame_us = esp_timer_get_time() - t_init;
+		ESP_LOGI(TAG, "first frame %lld us after lcd_init()", (long long)first_frame_us);
+	}
 
 #if 0
 	size_t size = (size_t)dev->width*dev->height;
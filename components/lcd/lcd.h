@@ -12,6 +12,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h> // size_t
 #include "hw.h"
 
 /** @name Use to create a custom color. */
@@ -33,6 +34,12 @@
 
 /** @} */
 
+/** @name Color key for transparent sprite pixels. */
+#define LCD_TRANSPARENT 0xFFFF
+
+/** @name Unity scale factor (16.16 fixed point) for transformed sprites. */
+#define LCD_SCALE_ONE 0x10000
+
 /** @name Character width and height in pixels. */
 /** @{ */
 #define LCD_CHAR_W 6
@@ -74,11 +81,37 @@ typedef enum {
 	SCROLL_UP = 4,
 } scroll_t;
 
+/** @brief Point type for polygon vertices. */
+typedef struct {
+	coord_t x;
+	coord_t y;
+} point_t;
+
+/** @brief Fill rule type for self-intersecting polygons. */
+typedef enum {
+	FILL_EVEN_ODD,
+	FILL_NON_ZERO
+} fill_rule_t;
+
 /**
  * @brief Initialize the LCD module.
  */
 void lcd_init(void);
 
+/**
+ * @brief Get the display bring-up time.
+ * @returns Microseconds from lcd_init() entry until the cleared screen
+ * was visible (display and backlight on).
+ */
+int64_t lcd_initTime(void);
+
+/**
+ * @brief Get the boot-to-first-frame time.
+ * @returns Microseconds from lcd_init() entry until the end of the first
+ * lcd_writeFrame(), or zero if no frame has been written yet.
+ */
+int64_t lcd_firstFrameTime(void);
+
 /** @name Draw (outline) and fill primitives. */
 /** @{ */
 
@@ -153,6 +186,19 @@ void lcd_drawRect(coord_t x, coord_t y, coord_t w, coord_t h, color_t color);
  */
 void lcd_fillRect(coord_t x, coord_t y, coord_t w, coord_t h, color_t color);
 
+/**
+ * @brief Draw a filled rectangle with a linear gradient between two 24-bit
+ *  colors, ordered (4x4 Bayer) dithered to RGB565 to avoid banding.
+ * @param x        Top left corner X coordinate.
+ * @param y        Top left corner Y coordinate.
+ * @param w        Width in pixels.
+ * @param h        Height in pixels.
+ * @param rgb0     Start color, 0xRRGGBB (top or left edge).
+ * @param rgb1     End color, 0xRRGGBB (bottom or right edge).
+ * @param vertical True for top to bottom, false for left to right.
+ */
+void lcd_fillRectGradient(coord_t x, coord_t y, coord_t w, coord_t h, uint32_t rgb0, uint32_t rgb1, bool vertical);
+
 /**
  * @brief Draw a triangle outline using 3 arbitrary points.
  * @param x0    X coordinate for Vertex 0.
@@ -253,6 +299,20 @@ void lcd_fillArrow(coord_t x0, coord_t y0, coord_t x1, coord_t y1, coord_t w, co
  */
 void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color);
 
+/**
+ * @brief Draw a 1-bit image at the specified location using the specified
+ *  colors for set and unset bits (opaque background).
+ * @param x      Top left corner X coordinate.
+ * @param y      Top left corner Y coordinate.
+ * @param bitmap Byte array with monochrome bitmap, one bit for each pixel.
+ * @param w      Width of bitmap in pixels.
+ * @param h      Height of bitmap in pixels.
+ * @param color  Color value for set bits.
+ * @param back   Color value for unset bits.
+ * @note  Same bitmap layout as lcd_drawBitmap().
+ */
+void lcd_drawBitmapBg(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coord_t h, color_t color, color_t back);
+
 /**
  * @brief Draw an image at the specified location.
  * @param x      Top left corner X coordinate.
@@ -263,6 +323,46 @@ void lcd_drawBitmap(coord_t x, coord_t y, const uint8_t *bitmap, coord_t w, coor
  */
 void lcd_drawRGBBitmap(coord_t x, coord_t y, const color_t *bitmap, coord_t w, coord_t h);
 
+/**
+ * @brief Decode a baseline JPEG image and draw it at the specified location.
+ * @details Decodes one MCU (up to 16x16 pixels) at a time, so working
+ * memory is a few KB (heap, freed on return) regardless of image size.
+ * Supports grayscale and YCbCr 4:4:4, 4:2:2 and 4:2:0 with 8-bit samples.
+ * @param x    Top left corner X coordinate.
+ * @param y    Top left corner Y coordinate.
+ * @param jpeg JPEG file data.
+ * @param size Size of JPEG data in bytes.
+ * @returns Zero if successful, or non-zero if the data is not supported.
+ */
+int32_t lcd_drawJpeg(coord_t x, coord_t y, const uint8_t *jpeg, size_t size);
+
+/**
+ * @brief Get the dimensions of a JPEG image without decoding it.
+ * @param jpeg JPEG file data.
+ * @param size Size of JPEG data in bytes.
+ * @param w    Returns width of image in pixels.
+ * @param h    Returns height of image in pixels.
+ * @returns Zero if successful, or non-zero otherwise.
+ */
+int32_t lcd_jpegSize(const uint8_t *jpeg, size_t size, coord_t *w, coord_t *h);
+
+/**
+ * @brief Draw a filled polygon using n arbitrary points.
+ * @param points Array of vertices, length = n. The last vertex is
+ *  connected back to the first.
+ * @param n      Number of vertices (3 or greater).
+ * @param color  Color value.
+ * @note  Self-intersecting polygons are filled according to the fill rule
+ *  set with lcd_setFillRule().
+ */
+void lcd_fillPolygon(const point_t *points, coord_t n, color_t color);
+
+/**
+ * @brief Set the fill rule used by lcd_fillPolygon().
+ * @param rule Fill rule, FILL_EVEN_ODD (default) or FILL_NON_ZERO.
+ */
+void lcd_setFillRule(fill_rule_t rule);
+
 /** @} */
 
 /** @name Rectangle variants that specify two diagonal corners. */
@@ -348,6 +448,33 @@ void lcd_drawTriangleC(coord_t xc, coord_t yc, coord_t w, coord_t h, angle_t ang
  */
 void lcd_drawRegularPolygonC(coord_t xc, coord_t yc, coord_t n, coord_t r, angle_t angle, color_t color);
 
+/**
+ * @brief Draw a filled regular polygon based on a center point.
+ * @param xc    Center X coordinate.
+ * @param yc    Center Y coordinate.
+ * @param n     Number of sides.
+ * @param r     Radius of polygon.
+ * @param angle Angle of rotation (degrees).
+ * @param color Color value.
+ */
+void lcd_fillRegularPolygonC(coord_t xc, coord_t yc, coord_t n, coord_t r, angle_t angle, color_t color);
+
+/**
+ * @brief Draw a sprite scaled and rotated about its center point.
+ * @param xc     Center X coordinate on screen.
+ * @param yc     Center Y coordinate on screen.
+ * @param sprite Array of color values, one for each pixel, length = w * h.
+ *  Pixels equal to LCD_TRANSPARENT are not drawn.
+ * @param w      Width of sprite in pixels.
+ * @param h      Height of sprite in pixels.
+ * @param scale  Scale factor in 16.16 fixed point, LCD_SCALE_ONE is 1.0.
+ * @param angle  Angle of rotation (degrees).
+ * @param flip   If true, mirror the sprite horizontally before rotation.
+ * @note  Pixels are sampled with nearest neighbor. Only the bounding box of
+ *  the transformed sprite is visited.
+ */
+void lcd_drawSpriteTransformed(coord_t xc, coord_t yc, const color_t *sprite, coord_t w, coord_t h, int32_t scale, angle_t angle, bool flip);
+
 /** @} */
 
 /** @name Draw characters and strings. */
@@ -373,6 +500,78 @@ coord_t lcd_drawChar(coord_t x, coord_t y, char ascii, color_t color);
  */
 coord_t lcd_drawString(coord_t x, coord_t y, const char *ascii, color_t color);
 
+/**
+ * @brief Draw a signed decimal integer without formatting to a string.
+ * @param x     Top left corner X coordinate.
+ * @param y     Top left corner Y coordinate.
+ * @param value Integer value.
+ * @param color Color value.
+ * @returns The coordinate (in X or Y) of a potential following character.
+ */
+coord_t lcd_drawInt(coord_t x, coord_t y, int32_t value, color_t color);
+
+/**
+ * @brief Draw a signed fixed-point decimal number.
+ * @param x     Top left corner X coordinate.
+ * @param y     Top left corner Y coordinate.
+ * @param value Number scaled by 10^frac, e.g. 1234 with frac 2 is "12.34".
+ * @param frac  Number of digits after the decimal point (0 to 9).
+ * @param color Color value.
+ * @returns The coordinate (in X or Y) of a potential following character.
+ */
+coord_t lcd_drawFixed(coord_t x, coord_t y, int32_t value, uint8_t frac, color_t color);
+
+/** @} */
+
+/** @name Fixed-width numeric fields for HUD counters. */
+/** @{ */
+
+/** @brief Maximum width of a numeric field in characters. */
+#define LCD_FIELD_MAX 12
+
+/**
+ * @brief State of a right-aligned, fixed-width numeric field.
+ * @details The characters last drawn are remembered so that an update only
+ *  redraws the character cells that changed.
+ */
+typedef struct {
+	coord_t x;                  /**< Top left corner X coordinate. */
+	coord_t y;                  /**< Top left corner Y coordinate. */
+	uint8_t width;              /**< Width of field in characters. */
+	uint8_t frac;               /**< Digits after the decimal point. */
+	uint8_t size;               /**< Font size when last drawn. */
+	color_t color;              /**< Foreground color. */
+	color_t back;               /**< Background color. */
+	char    text[LCD_FIELD_MAX]; /**< Characters currently displayed. */
+} lcd_field_t;
+
+/**
+ * @brief Initialize a numeric field. Nothing is drawn until the first update.
+ * @param field Field state.
+ * @param x     Top left corner X coordinate.
+ * @param y     Top left corner Y coordinate.
+ * @param width Width of field in characters (1 to LCD_FIELD_MAX).
+ * @param frac  Digits after the decimal point (0 for an integer).
+ * @param color Foreground color.
+ * @param back  Background color used to clear changed character cells.
+ */
+void lcd_fieldInit(lcd_field_t *field, coord_t x, coord_t y, uint8_t width, uint8_t frac, color_t color, color_t back);
+
+/**
+ * @brief Update a numeric field, redrawing only the characters that changed.
+ * @param field Field state.
+ * @param value Number scaled by 10^frac. Values that do not fit are shown
+ *  as '#' characters.
+ */
+void lcd_fieldUpdate(lcd_field_t *field, int32_t value);
+
+/**
+ * @brief Force the next update to redraw every character of the field,
+ *  e.g. after the screen or frame buffer has been cleared.
+ * @param field Field state.
+ */
+void lcd_fieldInvalidate(lcd_field_t *field);
+
 /** @} */
 
 /** @name Font parameters. */
@@ -407,6 +606,34 @@ void lcd_noFontBackground(void);
 /** @name Display configuration. */
 /** @{ */
 
+/**
+ * @brief Rotate the display by reprogramming the controller (MADCTL).
+ * @details The controller maps coordinates, so drawing and frame writes
+ * stay sequential with no per-pixel cost. Width and height are swapped
+ * for DIRECTION90 and DIRECTION270. Frame buffer contents are not
+ * rotated; redraw after the call. lcd_init() applies HW_LCD_DIR.
+ * @param rot Clockwise rotation from the native orientation.
+ */
+void lcd_setRotation(direction_t rot);
+
+/**
+ * @brief Get the display rotation.
+ * @returns Current rotation.
+ */
+direction_t lcd_getRotation(void);
+
+/**
+ * @brief Get the screen width for the current rotation.
+ * @returns Width in pixels (LCD_W or LCD_H).
+ */
+coord_t lcd_getWidth(void);
+
+/**
+ * @brief Get the screen height for the current rotation.
+ * @returns Height in pixels (LCD_H or LCD_W).
+ */
+coord_t lcd_getHeight(void);
+
 /**
  * @brief Set SPI clock frequency for SPI bus used by display.
  * @param freq Frequency in Hz.
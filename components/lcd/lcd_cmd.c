@@ -0,0 +1,165 @@
+// Bounded MPSC ring based on the per-slot sequence number scheme from:
+//   https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+
+#include <string.h> // strncpy
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+#include "lcd.h"
+#include "lcd_cmd.h"
+
+#define QMASK (LCD_CMD_QLEN-1)
+#define STACK_SZ 3072 // owner task stack size
+
+#if (LCD_CMD_QLEN & QMASK) != 0
+#error "LCD_CMD_QLEN must be a power of 2"
+#endif
+
+typedef struct {
+	_Atomic uint32_t seq; // slot is free for position seq, full for seq-1
+	lcd_cmd_t cmd;
+} slot_t;
+
+static const char *TAG = "lcd_cmd";
+
+static slot_t ring[LCD_CMD_QLEN];
+static _Atomic uint32_t head; // next position to claim (producers)
+static _Atomic uint32_t tail; // next position to execute (owner only writes)
+static _Atomic uint32_t drops;
+static _Atomic uint32_t max_depth;
+static TaskHandle_t owner_h;
+
+
+static void lcd_cmdExecute(const lcd_cmd_t *c)
+{
+	switch (c->op) {
+	case LCD_CMD_FILL_SCREEN: lcd_fillScreen(c->color); break;
+	case LCD_CMD_PIXEL:       lcd_drawPixel(c->x0, c->y0, c->color); break;
+	case LCD_CMD_HLINE:       lcd_drawHLine(c->x0, c->y0, c->x1, c->color); break;
+	case LCD_CMD_VLINE:       lcd_drawVLine(c->x0, c->y0, c->y1, c->color); break;
+	case LCD_CMD_LINE:        lcd_drawLine(c->x0, c->y0, c->x1, c->y1, c->color); break;
+	case LCD_CMD_RECT:        lcd_drawRect(c->x0, c->y0, c->x1, c->y1, c->color); break;
+	case LCD_CMD_FILL_RECT:   lcd_fillRect(c->x0, c->y0, c->x1, c->y1, c->color); break;
+	case LCD_CMD_CIRCLE:      lcd_drawCircle(c->x0, c->y0, c->x1, c->color); break;
+	case LCD_CMD_FILL_CIRCLE: lcd_fillCircle(c->x0, c->y0, c->x1, c->color); break;
+	case LCD_CMD_STRING:      lcd_drawString(c->x0, c->y0, c->text, c->color); break;
+	case LCD_CMD_INT:         lcd_drawInt(c->x0, c->y0, c->value, c->color); break;
+	case LCD_CMD_FONT_SIZE:   lcd_setFontSize(c->x0); break;
+	case LCD_CMD_FONT_BACK:   lcd_setFontBackground(c->color); break;
+	case LCD_CMD_NO_FONT_BACK: lcd_noFontBackground(); break;
+	case LCD_CMD_WRITE_FRAME: lcd_writeFrame(); break;
+	case LCD_CMD_CALL:        if (c->call.fn) c->call.fn(c->call.arg); break;
+	}
+}
+
+// Return the number of positions from t up to h, clamped to the ring
+// size. Head and tail are read at different times, so a tail read later
+// may already be past h.
+static uint32_t lcd_cmdSpan(uint32_t h, uint32_t t)
+{
+	int32_t d = (int32_t)(h - t);
+	if (d <= 0) return 0;
+	return (d > LCD_CMD_QLEN) ? LCD_CMD_QLEN : d;
+}
+
+// The only task that touches the display after lcd_cmdInit().
+static void lcd_cmdOwner(void *pvParameters)
+{
+	lcd_cmd_t cmd;
+
+	for (;;) {
+		uint32_t pos = atomic_load_explicit(&tail, memory_order_relaxed);
+		slot_t *s = &ring[pos & QMASK];
+		uint32_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+		if (seq != pos+1) { // empty, wait for a producer
+			ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			continue;
+		}
+		cmd = s->cmd; // copy out so the slot can be reused right away
+		atomic_store_explicit(&s->seq, pos+LCD_CMD_QLEN, memory_order_release);
+		atomic_store_explicit(&tail, pos+1, memory_order_relaxed);
+		lcd_cmdExecute(&cmd);
+	}
+}
+
+int32_t lcd_cmdInit(uint32_t priority)
+{
+	if (owner_h != NULL) return 0;
+	for (uint32_t i = 0; i < LCD_CMD_QLEN; i++) {
+		atomic_init(&ring[i].seq, i);
+	}
+	atomic_init(&head, 0);
+	atomic_init(&tail, 0);
+	atomic_init(&drops, 0);
+	atomic_init(&max_depth, 0);
+	if (xTaskCreate(lcd_cmdOwner, "lcd_owner", STACK_SZ, NULL, priority, &owner_h) != pdPASS) {
+		ESP_LOGE(TAG, "owner task create fail");
+		owner_h = NULL;
+		return 1;
+	}
+	return 0;
+}
+
+bool lcd_cmdActive(void)
+{
+	return owner_h != NULL;
+}
+
+bool lcd_cmdSubmit(const lcd_cmd_t *cmd)
+{
+	uint32_t pos = atomic_load_explicit(&head, memory_order_relaxed);
+	slot_t *s;
+
+	if (owner_h == NULL) return false;
+	for (;;) {
+		s = &ring[pos & QMASK];
+		uint32_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+		int32_t dif = (int32_t)(seq - pos);
+		if (dif == 0) { // slot free, try to claim it
+			if (atomic_compare_exchange_weak_explicit(&head, &pos, pos+1,
+				memory_order_relaxed, memory_order_relaxed)) break;
+		} else if (dif < 0) { // ring full
+			atomic_fetch_add_explicit(&drops, 1, memory_order_relaxed);
+			return false;
+		} else { // another producer claimed it first
+			pos = atomic_load_explicit(&head, memory_order_relaxed);
+		}
+	}
+	s->cmd = *cmd;
+	atomic_store_explicit(&s->seq, pos+1, memory_order_release);
+
+	uint32_t depth = lcd_cmdSpan(pos+1, atomic_load_explicit(&tail, memory_order_relaxed));
+	uint32_t mx = atomic_load_explicit(&max_depth, memory_order_relaxed);
+	while (depth > mx && !atomic_compare_exchange_weak_explicit(&max_depth, &mx, depth,
+		memory_order_relaxed, memory_order_relaxed));
+
+	xTaskNotifyGive(owner_h);
+	return true;
+}
+
+bool lcd_cmdString(coord_t x, coord_t y, const char *ascii, color_t color)
+{
+	lcd_cmd_t cmd = {.op = LCD_CMD_STRING, .color = color, .x0 = x, .y0 = y};
+	strncpy(cmd.text, ascii, LCD_CMD_TEXT-1);
+	cmd.text[LCD_CMD_TEXT-1] = '\0';
+	return lcd_cmdSubmit(&cmd);
+}
+
+uint32_t lcd_cmdDepth(void)
+{
+	uint32_t t = atomic_load_explicit(&tail, memory_order_relaxed);
+	return lcd_cmdSpan(atomic_load_explicit(&head, memory_order_relaxed), t);
+}
+
+uint32_t lcd_cmdMaxDepth(void)
+{
+	return atomic_load_explicit(&max_depth, memory_order_relaxed);
+}
+
+uint32_t lcd_cmdDrops(void)
+{
+	return atomic_load_explicit(&drops, memory_order_relaxed);
+}
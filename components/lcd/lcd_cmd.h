@@ -0,0 +1,111 @@
+#ifndef LCD_CMD_H_
+#define LCD_CMD_H_
+/**
+ * @file
+ * @brief Multi-task drawing through a lock-free command queue.
+ * @details The LCD functions keep global state and are not thread safe.
+ * In multi-producer mode, any task (including the timer daemon task)
+ * submits draw commands into a bounded lock-free ring. A single LCD owner
+ * task executes the commands in order. Producers never block on SPI: if
+ * the ring is full, the command is dropped and counted.
+ *
+ * After lcd_cmdInit() returns, only the owner task may call the lcd_*
+ * functions directly. Everything else goes through lcd_cmdSubmit().
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd.h"
+
+/** @brief Number of commands the ring can hold (power of 2). */
+#define LCD_CMD_QLEN 64
+
+/** @brief Maximum string length of a text command, including the NULL. */
+#define LCD_CMD_TEXT 24
+
+/** @brief Draw operation of a command. */
+typedef enum {
+	LCD_CMD_FILL_SCREEN, /**< color */
+	LCD_CMD_PIXEL,       /**< x0, y0, color */
+	LCD_CMD_HLINE,       /**< x0, y0, x1 = width, color */
+	LCD_CMD_VLINE,       /**< x0, y0, y1 = height, color */
+	LCD_CMD_LINE,        /**< x0, y0, x1, y1, color */
+	LCD_CMD_RECT,        /**< x0, y0, x1 = width, y1 = height, color */
+	LCD_CMD_FILL_RECT,   /**< x0, y0, x1 = width, y1 = height, color */
+	LCD_CMD_CIRCLE,      /**< x0, y0, x1 = radius, color */
+	LCD_CMD_FILL_CIRCLE, /**< x0, y0, x1 = radius, color */
+	LCD_CMD_STRING,      /**< x0, y0, text, color */
+	LCD_CMD_INT,         /**< x0, y0, value, color */
+	LCD_CMD_FONT_SIZE,   /**< x0 = size */
+	LCD_CMD_FONT_BACK,   /**< color */
+	LCD_CMD_NO_FONT_BACK,
+	LCD_CMD_WRITE_FRAME,
+	LCD_CMD_CALL,        /**< call.fn(call.arg) in the owner task */
+} lcd_op_t;
+
+/** @brief Draw command. Fields used depend on the operation. */
+typedef struct {
+	lcd_op_t op;
+	color_t  color;
+	coord_t  x0, y0, x1, y1;
+	union {
+		char    text[LCD_CMD_TEXT];
+		int32_t value;
+		struct {
+			void (*fn)(void *arg);
+			void *arg;
+		} call;
+	};
+} lcd_cmd_t;
+
+/**
+ * @brief Start the LCD owner task. Call after lcd_init().
+ * @param priority FreeRTOS priority of the owner task.
+ * @returns Zero if successful, or non-zero otherwise.
+ */
+int32_t lcd_cmdInit(uint32_t priority);
+
+/**
+ * @brief Check if the owner task is running.
+ * @returns True after a successful lcd_cmdInit(). Until then, commands are
+ * not queued and the caller may draw directly.
+ */
+bool lcd_cmdActive(void);
+
+/**
+ * @brief Submit a command to the owner task. Never blocks.
+ * @param cmd Command, copied into the ring.
+ * @returns True if queued, false if the ring was full (command dropped).
+ * @note Callable from any task, but not from an interrupt handler.
+ */
+bool lcd_cmdSubmit(const lcd_cmd_t *cmd);
+
+/**
+ * @brief Submit a string command. The string is truncated to fit.
+ * @param x     Top left corner X coordinate.
+ * @param y     Top left corner Y coordinate.
+ * @param ascii ASCII encoded string, zero terminated.
+ * @param color Color value.
+ * @returns True if queued, false if dropped.
+ */
+bool lcd_cmdString(coord_t x, coord_t y, const char *ascii, color_t color);
+
+/**
+ * @brief Get the number of commands waiting in the ring.
+ * @returns Queue depth.
+ */
+uint32_t lcd_cmdDepth(void);
+
+/**
+ * @brief Get the largest queue depth seen since lcd_cmdInit().
+ * @returns Queue depth high-water mark.
+ */
+uint32_t lcd_cmdMaxDepth(void);
+
+/**
+ * @brief Get the number of commands dropped because the ring was full.
+ * @returns Drop count.
+ */
+uint32_t lcd_cmdDrops(void);
+
+#endif // LCD_CMD_H_
@@ -0,0 +1,498 @@
+// Baseline JPEG decoder in the style of TJpgDec (ChaN). Each MCU is
+// decoded, converted to RGB565 and drawn before the next one is read, so
+// working memory stays at a few KB regardless of image size.
+// Supports baseline Huffman, 8-bit samples, grayscale or YCbCr with 4:4:4,
+// 4:2:2 and 4:2:0 sampling, and restart intervals. Progressive and
+// arithmetic coded images are rejected.
+
+#include <stdlib.h> // malloc, free
+#include <string.h> // memset, memcpy
+
+#include "esp_log.h"
+
+#include "lcd.h"
+
+#define HUFF_LUT_BITS 8 // codes this long or shorter decode in one lookup
+#define MAX_COMP 3
+
+typedef struct {
+	uint16_t lut[1 << HUFF_LUT_BITS]; // (length << 8) | symbol, 0 if longer
+	int32_t  maxcode[17]; // largest code of each length, -1 if none
+	int32_t  valoff[17];  // code to symbol index offset for each length
+	uint8_t  sym[256];
+} huff_t;
+
+typedef struct {
+	uint8_t id;
+	uint8_t h, v; // sampling factors
+	uint8_t tq;   // quantization table
+	uint8_t td, ta; // DC and AC Huffman tables
+	int32_t pred; // DC predictor
+} comp_t;
+
+typedef struct {
+	const uint8_t *p, *end; // input
+	uint32_t bits;  // bit buffer, left aligned
+	int32_t  nbits; // valid bits in buffer
+	bool     marker; // hit a marker in entropy data, feed zeros
+
+	uint16_t width, height;
+	uint8_t  ncomp;
+	uint8_t  hmax, vmax;
+	uint16_t restart; // restart interval in MCUs, 0 if none
+	comp_t   comp[MAX_COMP];
+
+	int32_t  qt[4][64]; // natural order, scaled for the AAN IDCT
+	huff_t   huff[2][2]; // [DC, AC][table]
+
+	int32_t  blk[64];       // dequantized coefficients
+	uint8_t  y[16*16];      // luma plane of one MCU
+	uint8_t  cb[64], cr[64];
+	color_t  out[16*16];    // RGB565 pixels of one MCU
+} jdec_t;
+
+static const char *TAG = "lcd_jpeg";
+
+static const uint8_t zigzag[64] = {
+	 0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+	12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+	35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+	58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63
+};
+
+// AAN IDCT scale factors, cos(k*pi/16)*sqrt(2) products scaled by 2^14.
+static const uint16_t aanscale[64] = {
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	22725, 31521, 29692, 26722, 22725, 17855, 12299,  6270,
+	21407, 29692, 27969, 25172, 21407, 16819, 11585,  5906,
+	19266, 26722, 25172, 22654, 19266, 15137, 10426,  5315,
+	16384, 22725, 21407, 19266, 16384, 12873,  8867,  4520,
+	12873, 17855, 16819, 15137, 12873, 10114,  6967,  3552,
+	 8867, 12299, 11585, 10426,  8867,  6967,  4799,  2446,
+	 4520,  6270,  5906,  5315,  4520,  3552,  2446,  1247
+};
+
+//----------------------------------------------------------------------------//
+// Markers
+//----------------------------------------------------------------------------//
+
+static inline uint16_t be16(const uint8_t *p)
+{
+	return (p[0] << 8) | p[1];
+}
+
+static int32_t parse_dqt(jdec_t *jd, const uint8_t *p, uint16_t len)
+{
+	while (len > 0) {
+		uint8_t pq = p[0] >> 4, tq = p[0] & 3;
+		uint16_t n = pq ? 129 : 65;
+		if (len < n) return 1;
+		for (uint32_t k = 0; k < 64; k++) {
+			uint32_t q = pq ? be16(p+1+k*2) : p[1+k];
+			uint8_t i = zigzag[k];
+			// 2 extra bits of precision carried through the IDCT
+			jd->qt[tq][i] = (int32_t)((q * aanscale[i] + (1 << 11)) >> 12);
+		}
+		p += n; len -= n;
+	}
+	return 0;
+}
+
+static int32_t parse_dht(jdec_t *jd, const uint8_t *p, uint16_t len)
+{
+	while (len > 17) {
+		uint8_t tc = p[0] >> 4, th = p[0] & 15;
+		const uint8_t *counts = p+1;
+		const uint8_t *syms = p+17;
+		uint32_t total = 0;
+		for (uint32_t i = 0; i < 16; i++) total += counts[i];
+		if (tc > 1 || th > 1 || total > 256 || len < 17+total) return 1;
+
+		huff_t *h = &jd->huff[tc][th];
+		memset(h->lut, 0, sizeof(h->lut));
+		memcpy(h->sym, syms, total);
+		int32_t code = 0, k = 0;
+		for (uint32_t l = 1; l <= 16; l++) {
+			h->valoff[l] = k - code;
+			for (uint32_t i = 0; i < counts[l-1]; i++, k++, code++) {
+				if (code >= (1 << l)) return 1; // more codes than fit in l bits
+				if (l <= HUFF_LUT_BITS) {
+					uint32_t shift = HUFF_LUT_BITS - l;
+					for (uint32_t j = 0; j < (1u << shift); j++) {
+						h->lut[(code << shift) | j] = (l << 8) | syms[k];
+					}
+				}
+			}
+			h->maxcode[l] = counts[l-1] ? code-1 : -1;
+			code <<= 1;
+		}
+		p += 17+total; len -= 17+total;
+	}
+	return 0;
+}
+
+static int32_t parse_sof(jdec_t *jd, const uint8_t *p, uint16_t len)
+{
+	if (len < 6 || p[0] != 8) return 1; // 8-bit samples only
+	jd->height = be16(p+1);
+	jd->width = be16(p+3);
+	jd->ncomp = p[5];
+	if (jd->ncomp != 1 && jd->ncomp != 3) return 1;
+	if (len < 6 + jd->ncomp*3) return 1;
+	jd->hmax = jd->vmax = 1;
+	for (uint32_t i = 0; i < jd->ncomp; i++) {
+		comp_t *c = &jd->comp[i];
+		c->id = p[6+i*3];
+		c->h = p[7+i*3] >> 4;
+		c->v = p[7+i*3] & 15;
+		c->tq = p[8+i*3] & 3;
+		if (c->h < 1 || c->h > 2 || c->v < 1 || c->v > 2) return 1;
+		if (i > 0 && (c->h != 1 || c->v != 1)) return 1; // chroma not subsampled
+		if (c->h > jd->hmax) jd->hmax = c->h;
+		if (c->v > jd->vmax) jd->vmax = c->v;
+	}
+	if (jd->ncomp == 1) jd->hmax = jd->vmax = jd->comp[0].h = jd->comp[0].v = 1;
+	return 0;
+}
+
+static int32_t parse_sos(jdec_t *jd, const uint8_t *p, uint16_t len)
+{
+	if (len < 1 || p[0] != jd->ncomp || len < 1 + p[0]*2) return 1; // interleaved only
+	for (uint32_t i = 0; i < jd->ncomp; i++) {
+		if (p[1+i*2] != jd->comp[i].id) return 1;
+		jd->comp[i].td = (p[2+i*2] >> 4) & 1;
+		jd->comp[i].ta = p[2+i*2] & 1;
+	}
+	return 0;
+}
+
+// Walk the markers up to the start of scan (or frame header if sof_only).
+static int32_t parse_headers(jdec_t *jd, const uint8_t *jpeg, size_t size, bool sof_only)
+{
+	const uint8_t *p = jpeg, *end = jpeg + size;
+	bool sof = false;
+
+	if (size < 4 || p[0] != 0xFF || p[1] != 0xD8) return 1; // SOI
+	p += 2;
+	while (p + 4 <= end) {
+		if (p[0] != 0xFF) return 1;
+		uint8_t m = p[1];
+		if (m == 0xFF) {p++; continue;} // fill byte
+		uint16_t len = be16(p+2);
+		if (len < 2 || p + 2 + len > end) return 1;
+		const uint8_t *seg = p+4;
+		len -= 2;
+		switch (m) {
+		case 0xC0: // SOF0 baseline
+		case 0xC1: // SOF1 extended, Huffman
+			if (parse_sof(jd, seg, len)) return 1;
+			sof = true;
+			if (sof_only) return 0;
+			break;
+		case 0xC2: case 0xC3: case 0xC5: case 0xC6: case 0xC7:
+		case 0xC9: case 0xCA: case 0xCB: case 0xCD: case 0xCE: case 0xCF:
+			ESP_LOGE(TAG, "unsupported frame type %02X", m);
+			return 1;
+		case 0xC4: if (parse_dht(jd, seg, len)) return 1; break;
+		case 0xDB: if (parse_dqt(jd, seg, len)) return 1; break;
+		case 0xDD: if (len < 2) return 1; jd->restart = be16(seg); break;
+		case 0xDA: // SOS
+			if (!sof || parse_sos(jd, seg, len)) return 1;
+			jd->p = seg + len;
+			jd->end = end;
+			return 0;
+		case 0xD9: return 1; // EOI before scan
+		default: break; // APPn, COM, ...
+		}
+		p = seg + len;
+	}
+	return 1;
+}
+
+//----------------------------------------------------------------------------//
+// Entropy decoding
+//----------------------------------------------------------------------------//
+
+static inline void bits_fill(jdec_t *jd)
+{
+	while (jd->nbits <= 24) {
+		uint32_t c = 0;
+		if (!jd->marker && jd->p < jd->end) {
+			c = *jd->p++;
+			if (c == 0xFF) {
+				if (jd->p < jd->end && *jd->p == 0x00) jd->p++; // stuffed byte
+				else {jd->marker = true; jd->p--; c = 0;}
+			}
+		}
+		jd->bits |= c << (24 - jd->nbits);
+		jd->nbits += 8;
+	}
+}
+
+static inline uint32_t bits_get(jdec_t *jd, uint32_t n)
+{
+	bits_fill(jd);
+	uint32_t v = jd->bits >> (32 - n);
+	jd->bits <<= n;
+	jd->nbits -= n;
+	return v;
+}
+
+static inline int32_t bits_extend(uint32_t v, uint32_t s)
+{
+	return (v < (1u << (s-1))) ? (int32_t)v - (1 << s) + 1 : (int32_t)v;
+}
+
+static inline int32_t huff_decode(jdec_t *jd, const huff_t *h)
+{
+	bits_fill(jd);
+	uint32_t peek = jd->bits >> 16;
+	uint16_t e = h->lut[peek >> (16 - HUFF_LUT_BITS)];
+	uint32_t l;
+
+	if (e) {
+		l = e >> 8;
+		jd->bits <<= l;
+		jd->nbits -= l;
+		return e & 0xFF;
+	}
+	int32_t code = -1;
+	for (l = HUFF_LUT_BITS+1; l <= 16; l++) {
+		code = peek >> (16-l);
+		if (code <= h->maxcode[l]) break;
+	}
+	if (l > 16) return -1;
+	jd->bits <<= l;
+	jd->nbits -= l;
+	return h->sym[(code + h->valoff[l]) & 0xFF];
+}
+
+// Decode one block into jd->blk. Returns -1 on error, 0 if only the DC
+// coefficient is present, 1 otherwise.
+static int32_t decode_block(jdec_t *jd, comp_t *c)
+{
+	const int32_t *qt = jd->qt[c->tq];
+	int32_t s, ac = 0;
+
+	s = huff_decode(jd, &jd->huff[0][c->td]);
+	if (s < 0 || s > 11) return -1;
+	if (s) c->pred += bits_extend(bits_get(jd, s), s);
+	memset(jd->blk, 0, sizeof(jd->blk));
+	jd->blk[0] = c->pred * qt[0];
+
+	for (uint32_t k = 1; k < 64; k++) {
+		int32_t rs = huff_decode(jd, &jd->huff[1][c->ta]);
+		if (rs < 0) return -1;
+		s = rs & 15;
+		if (s == 0) {
+			if (rs != 0xF0) break; // EOB
+			k += 15; // ZRL
+			continue;
+		}
+		k += rs >> 4;
+		if (k > 63) return -1;
+		uint8_t i = zigzag[k];
+		jd->blk[i] = bits_extend(bits_get(jd, s), s) * qt[i];
+		ac = 1;
+	}
+	return ac;
+}
+
+// Expect RSTn at a restart interval boundary and reset the decoder.
+static int32_t restart(jdec_t *jd)
+{
+	jd->bits = 0;
+	jd->nbits = 0;
+	if (!jd->marker) { // skip to the marker
+		while (jd->p + 1 < jd->end && !(jd->p[0] == 0xFF && jd->p[1] != 0x00)) jd->p++;
+	}
+	if (jd->p + 1 >= jd->end || (jd->p[1] & 0xF8) != 0xD0) return 1;
+	jd->p += 2;
+	jd->marker = false;
+	for (uint32_t i = 0; i < jd->ncomp; i++) jd->comp[i].pred = 0;
+	return 0;
+}
+
+//----------------------------------------------------------------------------//
+// IDCT and color conversion
+//----------------------------------------------------------------------------//
+
+#define FIX_1_082392200 277
+#define FIX_1_414213562 362
+#define FIX_1_847759065 473
+#define FIX_2_613125930 669
+#define MUL(v,c) (((v) * (c)) >> 8)
+
+#define PASS1_BITS 2
+
+static inline uint8_t clamp8(int32_t v)
+{
+	return (v < 0) ? 0 : (v > 255) ? 255 : v;
+}
+
+// One 8-point AAN butterfly (Arai, Agui, Nakajima) with input stride is.
+#define IDCT_1D(in, is, o0, o1, o2, o3, o4, o5, o6, o7) { \
+	int32_t t0, t1, t2, t3, t4, t5, t6, t7, t10, t11, t12, t13; \
+	int32_t z5, z10, z11, z12, z13; \
+	t10 = in[0*is] + in[4*is]; \
+	t11 = in[0*is] - in[4*is]; \
+	t13 = in[2*is] + in[6*is]; \
+	t12 = MUL(in[2*is] - in[6*is], FIX_1_414213562) - t13; \
+	t0 = t10 + t13; t3 = t10 - t13; \
+	t1 = t11 + t12; t2 = t11 - t12; \
+	z13 = in[5*is] + in[3*is]; z10 = in[5*is] - in[3*is]; \
+	z11 = in[1*is] + in[7*is]; z12 = in[1*is] - in[7*is]; \
+	t7 = z11 + z13; \
+	t11 = MUL(z11 - z13, FIX_1_414213562); \
+	z5 = MUL(z10 + z12, FIX_1_847759065); \
+	t10 = MUL(z12, FIX_1_082392200) - z5; \
+	t12 = MUL(z10, -FIX_2_613125930) + z5; \
+	t6 = t12 - t7; t5 = t11 - t6; t4 = t10 + t5; \
+	o0 = t0 + t7; o7 = t0 - t7; \
+	o1 = t1 + t6; o6 = t1 - t6; \
+	o2 = t2 + t5; o5 = t2 - t5; \
+	o4 = t3 + t4; o3 = t3 - t4; \
+}
+
+// Inverse DCT of jd->blk into an 8x8 area of a sample plane.
+static void idct(jdec_t *jd, uint8_t *dst, uint32_t stride, bool ac)
+{
+	int32_t *b = jd->blk;
+
+	if (!ac) { // flat block
+		uint8_t v = clamp8(((b[0] + (1 << (PASS1_BITS+2))) >> (PASS1_BITS+3)) + 128);
+		for (uint32_t j = 0; j < 8; j++, dst += stride) memset(dst, v, 8);
+		return;
+	}
+	for (uint32_t i = 0; i < 8; i++) { // columns, in place
+		int32_t *c = b+i;
+		if (!(c[8] | c[16] | c[24] | c[32] | c[40] | c[48] | c[56])) {
+			c[8] = c[16] = c[24] = c[32] = c[40] = c[48] = c[56] = c[0];
+			continue;
+		}
+		IDCT_1D(c, 8, c[0], c[8], c[16], c[24], c[32], c[40], c[48], c[56]);
+	}
+	for (uint32_t j = 0; j < 8; j++, dst += stride) { // rows
+		int32_t *r = b+j*8;
+		int32_t o[8];
+		// center on 128 and round the final descale
+		r[0] += (128 << (PASS1_BITS+3)) + (1 << (PASS1_BITS+2));
+		IDCT_1D(r, 1, o[0], o[1], o[2], o[3], o[4], o[5], o[6], o[7]);
+		for (uint32_t i = 0; i < 8; i++) dst[i] = clamp8(o[i] >> (PASS1_BITS+3));
+	}
+}
+
+// Convert the MCU planes to RGB565 (w x h pixels, packed).
+static void mcu_color(jdec_t *jd, uint32_t w, uint32_t h)
+{
+	uint32_t ystride = jd->hmax*8;
+	uint32_t sh = jd->hmax-1, sv = jd->vmax-1;
+	color_t *o = jd->out;
+
+	for (uint32_t j = 0; j < h; j++) {
+		const uint8_t *yp = jd->y + j*ystride;
+		if (jd->ncomp == 1) {
+			for (uint32_t i = 0; i < w; i++) {
+				uint32_t v = yp[i];
+				*o++ = rgb565(v, v, v);
+			}
+			continue;
+		}
+		const uint8_t *cbp = jd->cb + (j >> sv)*8;
+		const uint8_t *crp = jd->cr + (j >> sv)*8;
+		for (uint32_t i = 0; i < w; i++) {
+			int32_t y = yp[i];
+			int32_t cb = cbp[i >> sh] - 128;
+			int32_t cr = crp[i >> sh] - 128;
+			// ITU-R BT.601 (JFIF), 16-bit fixed point
+			int32_t r = y + ((91881*cr + 32768) >> 16);
+			int32_t g = y - ((22554*cb + 46802*cr - 32768) >> 16);
+			int32_t b = y + ((116130*cb + 32768) >> 16);
+			*o++ = rgb565(clamp8(r), clamp8(g), clamp8(b));
+		}
+	}
+}
+
+//----------------------------------------------------------------------------//
+// Public
+//----------------------------------------------------------------------------//
+
+int32_t lcd_jpegSize(const uint8_t *jpeg, size_t size, coord_t *w, coord_t *h)
+{
+	jdec_t *jd = malloc(sizeof(jdec_t));
+	int32_t ret = 1;
+
+	if (jd == NULL) return 1;
+	memset(jd, 0, sizeof(jdec_t));
+	if (!parse_headers(jd, jpeg, size, true)) {
+		*w = jd->width;
+		*h = jd->height;
+		ret = 0;
+	}
+	free(jd);
+	return ret;
+}
+
+/**
+ * @details MCUs are decoded one at a time (at most 16x16 pixels) and drawn
+ *  with lcd_drawRGBBitmap(), which writes into the frame buffer or streams
+ *  through one address window. MCUs fully off screen are entropy decoded
+ *  but skip the IDCT and color conversion.
+ */
+int32_t lcd_drawJpeg(coord_t x, coord_t y, const uint8_t *jpeg, size_t size)
+{
+	jdec_t *jd = malloc(sizeof(jdec_t));
+	int32_t ret = 1;
+
+	if (jd == NULL) {
+		ESP_LOGE(TAG, "decoder alloc fail");
+		return 1;
+	}
+	memset(jd, 0, sizeof(jdec_t));
+	if (parse_headers(jd, jpeg, size, false)) {
+		ESP_LOGE(TAG, "bad or unsupported JPEG");
+		goto done;
+	}
+
+	uint32_t mw = jd->hmax*8, mh = jd->vmax*8; // MCU size
+	uint32_t nx = (jd->width + mw-1) / mw;
+	uint32_t ny = (jd->height + mh-1) / mh;
+	uint32_t todo = jd->restart;
+	coord_t sw = lcd_getWidth(), sh = lcd_getHeight();
+
+	for (uint32_t my = 0; my < ny; my++) {
+		for (uint32_t mx = 0; mx < nx; mx++) {
+			if (jd->restart) {
+				if (todo == 0) {
+					if (restart(jd)) {ESP_LOGE(TAG, "restart marker"); goto done;}
+					todo = jd->restart;
+				}
+				todo--;
+			}
+			coord_t bx = x + mx*mw, by = y + my*mh;
+			uint32_t w = (mx*mw + mw > jd->width) ? jd->width - mx*mw : mw;
+			uint32_t h = (my*mh + mh > jd->height) ? jd->height - my*mh : mh;
+			bool vis = bx < sw && by < sh && bx+(coord_t)w > 0 && by+(coord_t)h > 0;
+
+			for (uint32_t ci = 0; ci < jd->ncomp; ci++) {
+				comp_t *c = &jd->comp[ci];
+				for (uint32_t v = 0; v < c->v; v++) {
+					for (uint32_t u = 0; u < c->h; u++) {
+						int32_t ac = decode_block(jd, c);
+						if (ac < 0) {ESP_LOGE(TAG, "bad entropy data"); goto done;}
+						if (!vis) continue;
+						if (ci == 0) idct(jd, jd->y + v*8*mw + u*8, mw, ac);
+						else idct(jd, (ci == 1) ? jd->cb : jd->cr, 8, ac);
+					}
+				}
+			}
+			if (!vis) continue;
+			mcu_color(jd, w, h);
+			lcd_drawRGBBitmap(bx, by, jd->out, w, h);
+		}
+	}
+	ret = 0;
+done:
+	free(jd);
+	return ret;
+}
@@ -0,0 +1,247 @@
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_system.h" // esp_get_free_heap_size
+#include "esp_timer.h"
+
+#include "pin.h"
+#include "perf.h"
+
+#define HIST 64 // frames in the frame time graph
+#define BAR_W 2 // graph bar width in pixels
+#define GRAPH_H 24 // graph height in pixels
+#define LINE_H (LCD_CHAR_H+1)
+#define PAD 2
+#define PANEL_W PERF_W // HIST*BAR_W + 2*PAD
+#define SAMPLE_US 500000 // heap and CPU load sample period
+
+#define PANEL_CLR rgb565(0, 0, 0)
+#define TEXT_CLR  rgb565(255, 255, 255)
+#define DIM_CLR   rgb565(160, 160, 160)
+#define BAR_CLR   rgb565(0, 200, 0)
+#define SLOW_CLR  rgb565(255, 48, 0)
+
+static bool visible, erase;
+static int32_t btn_pin;
+static bool btn_prev;
+static color_t back_color;
+static coord_t xpos, ypos;
+static bool right; // follow the right edge of the screen
+static coord_t drawn_h; // height of the panel last drawn
+
+static int64_t t_frame; // start of the current frame
+static int64_t t_mark; // last phase mark
+static uint32_t nphase, shown_phases;
+static const char *phase_name[PERF_PHASES];
+static uint32_t phase_us[PERF_PHASES]; // current frame
+static uint32_t shown_us[PERF_PHASES]; // last complete frame
+
+static uint16_t hist[HIST]; // frame times in units of 16 us
+static uint32_t hidx;
+static uint32_t frame_us; // last frame time
+static uint32_t hud_us; // time to draw the overlay
+
+static int64_t t_sample;
+static uint32_t heap_free, heap_min; // bytes
+static int32_t load[portNUM_PROCESSORS]; // percent, -1 if unknown
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static configRUN_TIME_COUNTER_TYPE idle_prev[portNUM_PROCESSORS];
+#endif
+
+
+// Sample free heap and per core load from the idle task run times.
+// The run-time counter is assumed to count microseconds (esp_timer).
+static void perf_sample(int64_t now)
+{
+	heap_free = esp_get_free_heap_size();
+	heap_min = esp_get_minimum_free_heap_size();
+	for (uint32_t i = 0; i < portNUM_PROCESSORS; i++) {
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+		configRUN_TIME_COUNTER_TYPE idle =
+			ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(i));
+		uint32_t elapsed = now - t_sample;
+		uint32_t didle = idle - idle_prev[i];
+		idle_prev[i] = idle;
+		if (t_sample == 0 || elapsed == 0) load[i] = -1;
+		else if (didle >= elapsed) load[i] = 0;
+		else load[i] = 100 - (int32_t)((uint64_t)didle*100/elapsed);
+#else
+		load[i] = -1;
+#endif
+	}
+	t_sample = now;
+}
+
+// Initialize the performance overlay. It starts hidden.
+// btn: I/O pin of an active low button that toggles the overlay,
+// polled in perf_frame(), or -1 for none.
+// back: color used to erase the overlay when it is hidden.
+// Return zero if successful, or non-zero otherwise.
+int32_t perf_init(int32_t btn, color_t back)
+{
+	if (btn >= 0 && (pin_reset(btn) || pin_input(btn, true))) return -1;
+	btn_pin = btn;
+	btn_prev = false;
+	back_color = back;
+	visible = erase = false;
+	right = true;
+	xpos = ypos = 0;
+	drawn_h = 0;
+	t_frame = t_mark = 0;
+	nphase = shown_phases = 0;
+	hidx = 0;
+	for (uint32_t i = 0; i < HIST; i++) hist[i] = 0;
+	frame_us = hud_us = 0;
+	t_sample = 0;
+	perf_sample(esp_timer_get_time());
+	return 0;
+}
+
+// Mark the start of a frame. Call once per frame.
+void perf_frame(void)
+{
+	int64_t now = esp_timer_get_time();
+
+	if (t_frame) {
+		frame_us = now - t_frame;
+		hist[hidx] = (frame_us >> 4 > UINT16_MAX) ? UINT16_MAX : frame_us >> 4;
+		hidx = (hidx+1) % HIST;
+	}
+	t_frame = t_mark = now;
+	for (uint32_t i = 0; i < nphase; i++) shown_us[i] = phase_us[i];
+	shown_phases = nphase;
+	nphase = 0;
+
+	if (btn_pin >= 0) {
+		bool pressed = (pin_get_level(btn_pin) == 0);
+		if (pressed && !btn_prev) perf_toggle();
+		btn_prev = pressed;
+	}
+	if (now - t_sample >= SAMPLE_US) perf_sample(now);
+}
+
+// Mark the end of a phase that started at the previous mark (or at the
+// start of the frame).
+// name: label of the phase (up to 7 characters), must point to static storage.
+void perf_mark(const char *name)
+{
+	int64_t now = esp_timer_get_time();
+
+	if (nphase < PERF_PHASES) {
+		phase_name[nphase] = name;
+		phase_us[nphase] = now - t_mark;
+		nphase++;
+	}
+	t_mark = now;
+}
+
+// Draw a time in microseconds as milliseconds with two decimals.
+static coord_t perf_draw_ms(coord_t x, coord_t y, uint32_t us, color_t color)
+{
+	x = lcd_drawFixed(x, y, (us+5)/10, 2, color);
+	return lcd_drawString(x, y, "ms", DIM_CLR);
+}
+
+// Draw the overlay into the frame buffer if visible. The font size is left
+// at 1 and the font background disabled.
+void perf_draw(void)
+{
+	int64_t start = esp_timer_get_time();
+	uint32_t sum = 0, max = 1;
+
+	if (!visible) {
+		if (erase) lcd_fillRect(xpos, ypos, PANEL_W, drawn_h, back_color);
+		erase = false;
+		return;
+	}
+	// The width changes with the rotation, so place the default corner
+	// at draw time.
+	if (right) xpos = lcd_getWidth() - PANEL_W;
+	coord_t x = xpos + PAD, y = ypos + PAD;
+	for (uint32_t i = 0; i < HIST; i++) {
+		sum += hist[i];
+		if (hist[i] > max) max = hist[i];
+	}
+	coord_t h = PAD + 4*LINE_H + shown_phases*LINE_H + GRAPH_H + PAD;
+	if (h < drawn_h) lcd_fillRect(xpos, ypos+h, PANEL_W, drawn_h-h, back_color);
+	drawn_h = h;
+	lcd_fillRect(xpos, ypos, PANEL_W, h, PANEL_CLR);
+	lcd_setFontSize(1);
+	lcd_noFontBackground();
+
+	// FPS from the average of the graph, and the last frame time.
+	coord_t cx = lcd_drawString(x, y, "fps ", DIM_CLR);
+	cx = lcd_drawFixed(cx, y, sum ? (uint32_t)(10*1000000ULL*HIST/16/sum) : 0, 1, TEXT_CLR);
+	cx = lcd_drawString(cx, y, "  ", DIM_CLR);
+	perf_draw_ms(cx, y, frame_us, TEXT_CLR);
+	y += LINE_H;
+
+	cx = lcd_drawString(x, y, "cpu", DIM_CLR);
+	for (uint32_t i = 0; i < portNUM_PROCESSORS; i++) {
+		cx = lcd_drawString(cx, y, " ", DIM_CLR);
+		if (load[i] < 0) cx = lcd_drawString(cx, y, "--", TEXT_CLR);
+		else cx = lcd_drawInt(cx, y, load[i], TEXT_CLR);
+		cx = lcd_drawString(cx, y, "%", DIM_CLR);
+	}
+	y += LINE_H;
+
+	cx = lcd_drawString(x, y, "heap ", DIM_CLR);
+	cx = lcd_drawInt(cx, y, heap_free >> 10, TEXT_CLR);
+	cx = lcd_drawString(cx, y, "k min ", DIM_CLR);
+	cx = lcd_drawInt(cx, y, heap_min >> 10, TEXT_CLR);
+	lcd_drawString(cx, y, "k", DIM_CLR);
+	y += LINE_H;
+
+	cx = lcd_drawString(x, y, "hud ", DIM_CLR);
+	cx = lcd_drawInt(cx, y, hud_us, TEXT_CLR);
+	lcd_drawString(cx, y, "us", DIM_CLR);
+	y += LINE_H;
+
+	for (uint32_t i = 0; i < shown_phases; i++, y += LINE_H) {
+		lcd_drawString(x, y, phase_name[i], DIM_CLR);
+		perf_draw_ms(x + 8*LCD_CHAR_W, y, shown_us[i], TEXT_CLR);
+	}
+
+	// Frame time graph, oldest on the left, scaled to the largest frame.
+	// Frames over 1.25x the average are highlighted.
+	uint32_t slow = sum*5/(4*HIST);
+	y += GRAPH_H;
+	for (uint32_t i = 0; i < HIST; i++) {
+		uint32_t v = hist[(hidx+i) % HIST];
+		coord_t bh = v*GRAPH_H/max;
+		if (bh) lcd_fillRect(x + i*BAR_W, y-bh, BAR_W, bh, (v > slow) ? SLOW_CLR : BAR_CLR);
+	}
+	hud_us = esp_timer_get_time() - start;
+}
+
+// Set the top left corner of the overlay. The default is the top right
+// corner of the screen, which moves with the screen rotation.
+// x: x coordinate.
+// y: y coordinate.
+void perf_set_pos(coord_t x, coord_t y)
+{
+	if (visible || erase) lcd_fillRect(xpos, ypos, PANEL_W, drawn_h, back_color);
+	erase = false;
+	right = false;
+	xpos = x;
+	ypos = y;
+}
+
+// Show or hide the overlay. Measurements continue while hidden.
+// vis: true to show.
+void perf_set_visible(bool vis)
+{
+	if (visible && !vis) erase = true;
+	visible = vis;
+}
+
+// Return true if the overlay is visible.
+bool perf_get_visible(void)
+{
+	return visible;
+}
+
+// Toggle the visibility of the overlay.
+void perf_toggle(void)
+{
+	perf_set_visible(!visible);
+}
@@ -0,0 +1,69 @@
+#ifndef PERF_H_
+#define PERF_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "lcd.h" // coord_t
+
+// This component measures frame performance and draws it as an overlay
+// in a corner of the LCD frame buffer. Each frame it samples the frame
+// time (shown as FPS and a graph of recent frames) and the time of named
+// phases within the frame. Twice a second it samples free heap and the
+// CPU load of each core from the FreeRTOS idle task run-time counters.
+// CPU load needs CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, otherwise "--"
+// is shown. The time taken to draw the overlay is shown as well.
+//
+// Typical frame:
+//   perf_frame();          // start of frame
+//   ...update...
+//   perf_mark("logic");    // end of first phase
+//   ...draw...
+//   perf_mark("draw");
+//   perf_draw();           // overlay, just before lcd_writeFrame()
+//   lcd_writeFrame();
+// The flush is accounted to the next frame's first phase unless marked
+// there with perf_mark() after lcd_writeFrame().
+
+// Maximum number of phases per frame. Extra marks are ignored.
+#define PERF_PHASES 6
+
+// Width of the overlay in pixels.
+#define PERF_W 132
+
+// Initialize the performance overlay. It starts hidden.
+// btn: I/O pin of an active low button that toggles the overlay,
+// polled in perf_frame(), or -1 for none.
+// back: color used to erase the overlay when it is hidden.
+// Return zero if successful, or non-zero otherwise.
+int32_t perf_init(int32_t btn, color_t back);
+
+// Mark the start of a frame. Call once per frame.
+void perf_frame(void);
+
+// Mark the end of a phase that started at the previous mark (or at the
+// start of the frame).
+// name: label of the phase (up to 7 characters), must point to static storage.
+void perf_mark(const char *name);
+
+// Draw the overlay into the frame buffer if visible. The font size is left
+// at 1 and the font background disabled.
+void perf_draw(void);
+
+// Set the top left corner of the overlay. The default is the top right
+// corner of the screen, which moves with the screen rotation.
+// x: x coordinate.
+// y: y coordinate.
+void perf_set_pos(coord_t x, coord_t y);
+
+// Show or hide the overlay. Measurements continue while hidden.
+// vis: true to show.
+void perf_set_visible(bool vis);
+
+// Return true if the overlay is visible.
+bool perf_get_visible(void);
+
+// Toggle the visibility of the overlay.
+void perf_toggle(void);
+
+#endif // PERF_H_
@@ -0,0 +1,63 @@
+// IMA ADPCM, from the IMA Digital Audio Focus and Technical Working
+// Groups recommended practice (1992).
+
+#include "freertos/FreeRTOS.h" // IRAM_ATTR, DRAM_ATTR
+
+#include "adpcm.h"
+
+#define INDEX_MAX 88
+
+// Tables are kept in DRAM so the ISR can decode with the flash cache off.
+static const DRAM_ATTR int16_t step_tab[INDEX_MAX+1] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+	19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+	130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+	337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+	876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+	5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const DRAM_ATTR int8_t index_tab[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+
+// Reset the decoder state to the start of a clip.
+// st: decoder state.
+void adpcm_reset(adpcm_state_t *st)
+{
+	st->pred = 0;
+	st->index = 0;
+}
+
+// Decode samples of a clip. Safe to call from an IRAM ISR.
+// st: decoder state at sample position pos, updated to pos+n.
+// codes: the clip's packed 4-bit codes.
+// pos: sample position of the first code to decode.
+// dst: where to put signed 16-bit samples.
+// n: number of samples to decode.
+void IRAM_ATTR adpcm_decode(adpcm_state_t *st, const uint8_t *codes, uint32_t pos,
+	int16_t *dst, uint32_t n)
+{
+	int32_t pred = st->pred;
+	int32_t index = st->index;
+
+	for (uint32_t i = 0; i < n; i++, pos++) {
+		uint32_t code = (codes[pos >> 1] >> ((pos & 1) << 2)) & 0xF;
+		int32_t step = step_tab[index];
+		int32_t diff = step >> 3;
+		if (code & 4) diff += step;
+		if (code & 2) diff += step >> 1;
+		if (code & 1) diff += step >> 2;
+		pred += (code & 8) ? -diff : diff;
+		if (pred > INT16_MAX) pred = INT16_MAX;
+		else if (pred < INT16_MIN) pred = INT16_MIN;
+		index += index_tab[code & 7];
+		if (index < 0) index = 0;
+		else if (index > INDEX_MAX) index = INDEX_MAX;
+		dst[i] = pred;
+	}
+	st->pred = pred;
+	st->index = index;
+}
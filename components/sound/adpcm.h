@@ -0,0 +1,30 @@
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#include <stdint.h>
+
+// IMA ADPCM decoder for 4-bit clips made by audio/audio2adpcm.m.
+// Codes are packed two per byte, low nibble first. A clip is encoded
+// from the initial state (predictor 0, step index 0) so it can be
+// decoded from the start or restarted without side information.
+
+// Decoder state of one clip.
+typedef struct {
+	int16_t pred; // predicted sample
+	uint8_t index; // step table index 0-88
+} adpcm_state_t;
+
+// Reset the decoder state to the start of a clip.
+// st: decoder state.
+void adpcm_reset(adpcm_state_t *st);
+
+// Decode samples of a clip. Safe to call from an IRAM ISR.
+// st: decoder state at sample position pos, updated to pos+n.
+// codes: the clip's packed 4-bit codes.
+// pos: sample position of the first code to decode.
+// dst: where to put signed 16-bit samples.
+// n: number of samples to decode.
+void adpcm_decode(adpcm_state_t *st, const uint8_t *codes, uint32_t pos,
+	int16_t *dst, uint32_t n);
+
+#endif // ADPCM_H_
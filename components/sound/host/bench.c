@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "esp_cpu.h"
+
+#include "sound.h"
+#include "sound_host.h"
+
+// Build from the repository root like render (see sound_host.h), with
+// bench.c in place of render.c and without tone.c. The DMA driver is
+// measured, so sound_one.c is not supported.
+//
+// Times are in ns, since esp_cpu_get_cycle_count() counts ns on the host.
+// They compare kernels on one machine; the target takes several times as
+// many cycles as the host takes ns. The mixer rows time whole refills from
+// the driver's event log, so they include the refill bookkeeping that the
+// old kernel row leaves out.
+
+#define OUT_HZ 48000
+#define ROUNDS 200 // runs of SOUND_EVENTS refills
+#define RUNS (ROUNDS*SOUND_EVENTS) // blocks timed in each case
+#define CLIP_LEN 1000 // samples, not a divisor of the block length
+#define VOICES 8
+#define VOL_DEMO 50U
+#define PERCENT 100U
+
+static uint8_t clip[CLIP_LEN];
+static uint8_t codes[CLIP_LEN/2]; // ADPCM, two codes per byte
+static uint32_t cost[RUNS];
+static sound_voice_t voice[VOICES]; // voices started by a case
+
+// Volume and clip length as seen by the old ISR, kept out of the compiler's
+// reach so it can't fold them.
+static volatile uint32_t volume = VOL_DEMO, asize = CLIP_LEN;
+
+static int cmp_u32(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+	return (x > y) - (x < y);
+}
+
+// Print the fastest and median of n costs, per block and per sample.
+static void report(const char *name, uint32_t *c, uint32_t n, uint32_t len)
+{
+	qsort(c, n, sizeof(c[0]), cmp_u32);
+	printf("%-30s %7u %7u %9.2f %9.2f\n", name, (unsigned)c[0], (unsigned)c[n/2],
+		(double)c[0]/len, (double)c[n/2]/len);
+}
+
+// The single-buffer copy of dac_convert_callback() before the volume
+// table: a modulo and a multiply-divide per sample.
+static void old_kernel(uint8_t *buf, uint32_t idx, uint32_t size)
+{
+	uint32_t bias = (PERCENT-volume)*0x80/PERCENT;
+	for (uint32_t i = 0; i < size; i++) buf[i] = clip[(idx+i)%asize]*volume/PERCENT + bias;
+}
+
+// The same copy through a volume table built as sound_set_volume() does,
+// in contiguous segments up to the wrap point.
+static void table_kernel(uint8_t *buf, uint32_t idx, uint32_t size)
+{
+	static uint8_t lut[256];
+	static uint32_t lut_vol;
+
+	if (lut_vol != volume) { // rebuilt on a volume change only
+		uint32_t bias = (PERCENT-volume)*0x80/PERCENT;
+		for (uint32_t s = 0; s < 256; s++) lut[s] = s*volume/PERCENT + bias;
+		lut_vol = volume;
+	}
+	for (uint32_t i = 0; i < size; ) {
+		uint32_t seg = asize - idx;
+		if (seg > size - i) seg = size - i;
+		for (uint32_t k = 0; k < seg; k++) buf[i+k] = lut[clip[idx+k]];
+		i += seg;
+		idx += seg;
+		if (idx == asize) idx = 0;
+	}
+}
+
+// Time a single-buffer kernel on blocks of len samples, wrapping round
+// the clip.
+static void bench_kernel(const char *name, void (*kernel)(uint8_t *, uint32_t, uint32_t),
+	uint32_t len)
+{
+	uint8_t buf[1024];
+	uint32_t idx = 0;
+
+	for (uint32_t r = 0; r < RUNS; r++) {
+		uint32_t t0 = esp_cpu_get_cycle_count();
+		kernel(buf, idx, len);
+		cost[r] = esp_cpu_get_cycle_count() - t0;
+		idx = (idx + len) % CLIP_LEN;
+	}
+	report(name, cost, RUNS, len);
+}
+
+// Play the voices started by start(), and time the driver's refills from
+// its event log. Return the samples per block.
+static uint32_t bench_mix(const char *name, void (*start)(uint32_t hz), uint32_t hz)
+{
+	sound_event_t ev[SOUND_EVENTS];
+	sound_stats_t st;
+	uint32_t n = 0, refills = 0;
+
+	start(hz);
+	sound_host_run(100); // settle
+	uint64_t s0 = sound_host_samples();
+	for (uint32_t r = 0; r < ROUNDS; r++) {
+		sound_reset_stats();
+		while (sound_get_events(ev, SOUND_EVENTS) < SOUND_EVENTS) sound_host_run(1);
+		for (uint32_t i = 0; i < SOUND_EVENTS; i++) cost[n++] = ev[i].cycles;
+		sound_get_stats(&st);
+		refills += st.refills;
+	}
+	uint32_t len = (sound_host_samples() - s0 + refills/2) / refills;
+	for (uint32_t i = 0; i < VOICES; i++) sound_voice_stop(voice[i]);
+	sound_host_run(100); // play out
+	report(name, cost, n, len);
+	return len;
+}
+
+static void start_one(uint32_t hz)
+{
+	for (uint32_t i = 0; i < VOICES; i++) voice[i] = -1;
+	voice[0] = sound_play(clip, CLIP_LEN, hz, VOL_DEMO, true, 1);
+}
+
+static void start_pcm(uint32_t hz)
+{
+	for (uint32_t i = 0; i < VOICES; i++) voice[i] = sound_play(clip, CLIP_LEN, hz, VOL_DEMO/2, true, 1);
+}
+
+static void start_adpcm(uint32_t hz)
+{
+	for (uint32_t i = 0; i < VOICES; i++) voice[i] = sound_play_adpcm(codes, CLIP_LEN, hz, VOL_DEMO/2, true, 1);
+}
+
+
+// Compare the old single-buffer kernel with the volume table and segment
+// copy, and time the mixer. The resampler's cost per output sample is the
+// difference between voices at their own rate and at the output rate.
+// Nothing is written to WAV files.
+// Usage: bench
+int main(void)
+{
+	uint32_t x = 1;
+	for (uint32_t i = 0; i < CLIP_LEN; i++) clip[i] = 0x80 + (i*7 % 97) - 48;
+	for (uint32_t i = 0; i < sizeof(codes); i++) codes[i] = (x = x*1103515245 + 12345) >> 24;
+
+	if (sound_init(OUT_HZ)) {
+		fprintf(stderr, "sound_init failed\n");
+		return EXIT_FAILURE;
+	}
+	sound_set_volume(VOL_DEMO);
+	printf("%-30s %7s %7s %9s %9s\n", "ns", "block", "median", "sample", "median");
+	uint32_t len = bench_mix("mixer, 1 voice", start_one, 0);
+	bench_kernel("modulo/divide kernel", old_kernel, len);
+	bench_kernel("table+segment kernel", table_kernel, len);
+	bench_mix("8 voices, output rate", start_pcm, 0);
+	bench_mix("8 voices, 44.1 kHz resampled", start_pcm, 44100);
+	bench_mix("8 voices, 24 kHz resampled", start_pcm, 24000);
+	bench_mix("8 ADPCM voices, output rate", start_adpcm, 0);
+	bench_mix("8 ADPCM voices, 24 kHz", start_adpcm, 24000);
+	printf("%u samples per block at %u Hz\n", (unsigned)len, OUT_HZ);
+	sound_deinit();
+	return EXIT_SUCCESS;
+}
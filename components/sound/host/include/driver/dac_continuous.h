@@ -0,0 +1,53 @@
+#ifndef DAC_CONTINUOUS_H_
+#define DAC_CONTINUOUS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define CONFIG_DAC_DMA_AUTO_16BIT_ALIGN 0 // one byte per sample on the host
+
+#define DAC_CHANNEL_MASK_CH1 2
+#define DAC_DIGI_CLK_SRC_DEFAULT 0
+#define DAC_CHANNEL_MODE_SIMUL 0
+
+typedef struct dac_continuous_s *dac_continuous_handle_t;
+
+typedef struct {
+	int chan_mask;
+	uint32_t desc_num;
+	size_t buf_size;
+	uint32_t freq_hz;
+	int8_t offset;
+	int clk_src;
+	int chan_mode;
+} dac_continuous_config_t;
+
+typedef struct {
+	void *buf;
+	size_t buf_size;
+	size_t write_bytes;
+} dac_event_data_t;
+
+typedef bool (*dac_isr_callback_t)(dac_continuous_handle_t handle,
+	const dac_event_data_t *event, void *user_data);
+
+typedef struct {
+	dac_isr_callback_t on_convert_done;
+	dac_isr_callback_t on_stop;
+} dac_event_callbacks_t;
+
+esp_err_t dac_continuous_new_channels(const dac_continuous_config_t *cfg, dac_continuous_handle_t *handle);
+esp_err_t dac_continuous_del_channels(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_enable(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_disable(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_register_event_callback(dac_continuous_handle_t handle,
+	const dac_event_callbacks_t *callbacks, void *user_data);
+esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_stop_async_writing(dac_continuous_handle_t handle);
+esp_err_t dac_continuous_write_asynchronously(dac_continuous_handle_t handle,
+	uint8_t *dma_buf, size_t dma_buf_len, const uint8_t *data, size_t data_len,
+	size_t *bytes_loaded);
+
+#endif // DAC_CONTINUOUS_H_
@@ -0,0 +1,19 @@
+#ifndef DAC_ONESHOT_H_
+#define DAC_ONESHOT_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#define DAC_CHAN_1 1
+
+typedef struct dac_oneshot_s *dac_oneshot_handle_t;
+
+typedef struct {
+	int chan_id;
+} dac_oneshot_config_t;
+
+esp_err_t dac_oneshot_new_channel(const dac_oneshot_config_t *cfg, dac_oneshot_handle_t *handle);
+esp_err_t dac_oneshot_del_channel(dac_oneshot_handle_t handle);
+esp_err_t dac_oneshot_output_voltage(dac_oneshot_handle_t handle, uint8_t digi_value);
+
+#endif // DAC_ONESHOT_H_
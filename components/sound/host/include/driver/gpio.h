@@ -0,0 +1,21 @@
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#define GPIO_INTR_DISABLE 0
+#define GPIO_MODE_OUTPUT 2
+
+typedef struct {
+	uint64_t pin_bit_mask;
+	int mode;
+	int pull_up_en;
+	int pull_down_en;
+	int intr_type;
+} gpio_config_t;
+
+esp_err_t gpio_config(const gpio_config_t *cfg);
+esp_err_t gpio_set_level(int gpio, uint32_t level);
+
+#endif // GPIO_H_
@@ -0,0 +1,49 @@
+#ifndef GPTIMER_H_
+#define GPTIMER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#define GPTIMER_CLK_SRC_DEFAULT 0
+#define GPTIMER_COUNT_UP 0
+
+typedef struct gptimer_s *gptimer_handle_t;
+
+typedef struct {
+	int clk_src;
+	int direction;
+	uint32_t resolution_hz;
+} gptimer_config_t;
+
+typedef struct {
+	uint64_t count_value;
+	uint64_t alarm_value;
+} gptimer_alarm_event_data_t;
+
+typedef bool (*gptimer_alarm_cb_t)(gptimer_handle_t timer,
+	const gptimer_alarm_event_data_t *edata, void *user_ctx);
+
+typedef struct {
+	gptimer_alarm_cb_t on_alarm;
+} gptimer_event_callbacks_t;
+
+typedef struct {
+	uint64_t alarm_count;
+	uint64_t reload_count;
+	struct {
+		uint32_t auto_reload_on_alarm: 1;
+	} flags;
+} gptimer_alarm_config_t;
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *cfg, gptimer_handle_t *timer);
+esp_err_t gptimer_del_timer(gptimer_handle_t timer);
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t timer,
+	const gptimer_event_callbacks_t *cbs, void *user_data);
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t timer, const gptimer_alarm_config_t *cfg);
+esp_err_t gptimer_enable(gptimer_handle_t timer);
+esp_err_t gptimer_disable(gptimer_handle_t timer);
+esp_err_t gptimer_start(gptimer_handle_t timer);
+esp_err_t gptimer_stop(gptimer_handle_t timer);
+
+#endif // GPTIMER_H_
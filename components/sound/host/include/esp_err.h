@@ -0,0 +1,11 @@
+#ifndef ESP_ERR_H_
+#define ESP_ERR_H_
+
+typedef int esp_err_t;
+
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NOT_FOUND 0x105
+#define ESP_ERROR_CHECK(x) do { esp_err_t err_ = (x); (void)err_; } while (0)
+
+#endif // ESP_ERR_H_
@@ -0,0 +1,32 @@
+// Host stand-in for the partition API used by the sound component. There
+// are no partitions on the host, so streams are played from files.
+
+#ifndef ESP_PARTITION_H_
+#define ESP_PARTITION_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "esp_err.h"
+
+typedef enum {ESP_PARTITION_TYPE_APP, ESP_PARTITION_TYPE_DATA} esp_partition_type_t;
+typedef enum {ESP_PARTITION_SUBTYPE_ANY = 0xff} esp_partition_subtype_t;
+typedef enum {ESP_PARTITION_MMAP_DATA, ESP_PARTITION_MMAP_INST} esp_partition_mmap_memory_t;
+typedef uint32_t esp_partition_mmap_handle_t;
+
+typedef struct {
+	esp_partition_type_t type;
+	esp_partition_subtype_t subtype;
+	uint32_t address;
+	uint32_t size;
+	char label[17];
+} esp_partition_t;
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+	esp_partition_subtype_t subtype, const char *label);
+esp_err_t esp_partition_mmap(const esp_partition_t *part, size_t offset, size_t size,
+	esp_partition_mmap_memory_t memory, const void **out_ptr,
+	esp_partition_mmap_handle_t *out_handle);
+void esp_partition_munmap(esp_partition_mmap_handle_t handle);
+
+#endif // ESP_PARTITION_H_
@@ -0,0 +1,34 @@
+// Host stand-in for the parts of FreeRTOS used by the sound component.
+// Tasks run on threads, but never at the same time as the audio code
+// (sound_host.c), so critical sections do nothing. vTaskDelay() outside a
+// task advances the virtual audio clock.
+
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef struct {int unused;} portMUX_TYPE;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY UINT32_MAX
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS (1000/configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms)*configTICK_RATE_HZ/1000)
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(m) (void)(m)
+#define portEXIT_CRITICAL(m) (void)(m)
+#define portENTER_CRITICAL_ISR(m) (void)(m)
+#define portEXIT_CRITICAL_ISR(m) (void)(m)
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif // FREERTOS_H_
@@ -0,0 +1,15 @@
+#ifndef TASK_H_
+#define TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskCreate(void (*fn)(void *), const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t handle);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskNotifyGive(TaskHandle_t handle);
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+
+#endif // TASK_H_
@@ -0,0 +1,688 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+
+#include "tone.h"
+#include "adpcm.h"
+#include "sound_host.h"
+
+#define SAMPLE_HZ 24000
+#define TONE_MS 500
+#define TONE_FREQ 440
+#define VOL_DEMO 50U
+#define SETTLE_MS 20 // quiet time before a latency trial
+#define PHASES 8 // latency trials, each 1 ms later against the DMA blocks
+#define HEAR_MS 1000 // longest wait for a click
+#define CLIP_N (SAMPLE_HZ/4) // samples in the ADPCM test clip
+#define LAG_MAX 4096 // longest output delay searched for, in samples
+#define ADPCM_SNR_MIN 24.0 // dB, decoded clip against the source PCM
+#define DAC_SNR_MIN 22.0 // dB, clip played through the mixer to the DAC
+#define DFT_N 8192 // samples in the alias check, a power of 2
+#define LOBE 3 // bins either side of a harmonic counted as the harmonic
+#define DC_BINS 4 // bins at 0 Hz left out, the DAC offset
+#define ALIAS_MAX -30.0 // dB, energy off the harmonics relative to them
+#define QUEUE_REC (SAMPLE_HZ/2) // samples recorded in the queue check
+#define TICK_MS 50 // sequencer tick in the pattern check
+#define PAT_REC (SAMPLE_HZ*3/2) // samples recorded in the pattern check
+#define ENV_TOL 0.03 // envelope error allowed, relative to full level
+#define FREQ_TOL 0.001 // note frequency error allowed, relative
+#define STREAM_N 20011 // bytes in the streamed file, not a multiple of any block
+#define STREAM_LAT_MS 10 // latency of the stream check, for blocks not dividing the ring
+#define HOLD_MS 150 // time the prefetch task is held back, longer than its ring
+
+
+// Open a WAV file named dir/name.wav.
+static int32_t open_wav(const char *dir, const char *name)
+{
+	char path[256];
+
+	snprintf(path, sizeof(path), "%s/%s.wav", dir, name);
+	if (sound_host_wav_open(path)) {
+		fprintf(stderr, "can't write %s\n", path);
+		return -1;
+	}
+	printf("%s\n", path);
+	return 0;
+}
+
+static const char *tone_name[LAST_T] = {"sine", "square", "triangle", "saw"};
+
+// Render each tone waveform.
+static int32_t render_tones(const char *dir)
+{
+	for (tone_t t = SINE_T; t < LAST_T; t++) {
+		if (open_wav(dir, tone_name[t])) return -1;
+		tone_start(t, TONE_FREQ);
+		sound_host_run(TONE_MS);
+		tone_stop();
+		sound_host_wav_close();
+	}
+	return 0;
+}
+
+#ifdef SOUND_ONESHOT
+// Play one period of a ramp cyclically.
+static int32_t render_cyclic(const char *dir)
+{
+	static uint8_t ramp[SAMPLE_HZ/TONE_FREQ];
+
+	for (uint32_t i = 0; i < sizeof(ramp); i++) ramp[i] = i*256/sizeof(ramp);
+	if (open_wav(dir, "cyclic")) return -1;
+	sound_cyclic(ramp, sizeof(ramp));
+	sound_host_run(TONE_MS);
+	sound_stop();
+	sound_host_wav_close();
+	return 0;
+}
+#else
+
+// Play a short tune through the tone sequencer until it ends, and any
+// echo has died away.
+static int32_t render_pattern(const char *dir, const char *name)
+{
+	static const tone_env_t env[] = {
+		{.attack_ms = 5, .decay_ms = 60, .sustain = 60, .release_ms = 40},
+		{.attack_ms = 1, .decay_ms = 0, .sustain = 100, .release_ms = 5},
+	};
+	static const tone_note_t tune[] = {
+		{60, SINE_T, 0, 2}, {64, SINE_T, 0, 2}, {67, TRIANGLE_T, 0, 2},
+		{TONE_REST, 0, 0, 1}, {72, SQUARE_T, 1, 1}, {72, SAW_T, 1, 3},
+		{TONE_END},
+	};
+
+	if (open_wav(dir, name)) return -1;
+	if (tone_play(tune, env, 100, false)) return -1;
+	while (tone_play_busy()) sound_host_run(TONE_MS/10);
+	sound_host_run(TONE_MS); // play out the DMA buffers and any echo
+	sound_host_wav_close();
+	return 0;
+}
+
+// Play the tune through a low-pass filter, echo and limiter, then let
+// the echo die away.
+static int32_t render_fx(const char *dir)
+{
+	static const sound_fx_t chain[] = {
+		{.type = SOUND_FX_LPF, .lpf = {.cutoff_hz = 3000, .q100 = 71}},
+		{.type = SOUND_FX_ECHO, .echo = {.delay_ms = 150, .feedback = 50, .mix = 60}},
+		{.type = SOUND_FX_LIMIT, .limit = {.threshold = 50}},
+	};
+	sound_fx_stats_t st;
+
+	if (sound_fx_set(chain, sizeof(chain)/sizeof(chain[0]))) return -1;
+	sound_set_volume(MAX_VOL);
+	if (render_pattern(dir, "fx")) return -1;
+	for (uint32_t i = 0; sound_fx_get_stats(i, &st) == 0; i++)
+		printf("effect %u: max %u cycles (ns on the host)\n", (unsigned)i, (unsigned)st.max_cycles);
+	sound_fx_set(NULL, 0);
+	sound_set_volume(VOL_DEMO);
+	return 0;
+}
+
+// Mix two clips at different rates and volumes with a tone, as a check of
+// the mixer and resampler.
+static int32_t render_mix(const char *dir)
+{
+	static uint8_t low[SAMPLE_HZ/2/110], high[SAMPLE_HZ/660];
+	uint32_t i;
+
+	for (i = 0; i < sizeof(low); i++) low[i] = (i < sizeof(low)/2) ? 0x60 : 0xA0;
+	for (i = 0; i < sizeof(high); i++) high[i] = 0x80 + (int32_t)(i*0x40/sizeof(high)) - 0x20;
+	if (open_wav(dir, "mix")) return -1;
+	tone_start(SINE_T, TONE_FREQ);
+	sound_voice_t a = sound_play(low, sizeof(low), SAMPLE_HZ/2, VOL_DEMO, true, 1);
+	sound_host_run(TONE_MS);
+	sound_voice_t b = sound_play(high, sizeof(high), SAMPLE_HZ, VOL_DEMO, true, 1);
+	sound_host_run(TONE_MS);
+	sound_voice_stop(a);
+	sound_voice_stop(b);
+	sound_host_run(TONE_MS);
+	tone_stop();
+	sound_host_wav_close();
+	return 0;
+}
+
+// IMA ADPCM encoder, a port of ima_encode() in audio/audio2adpcm.m.
+// Encodes from predictor 0 and step index 0 as adpcm.c expects.
+// x: signed 16-bit samples.
+// n: number of samples.
+// codes: where to put the codes, two per byte, low nibble first.
+// xd: where to put the samples the decoder will reproduce.
+static void ima_encode(const int16_t *x, uint32_t n, uint8_t *codes, int16_t *xd)
+{
+	static const int16_t step_tab[89] = {
+		7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+		19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+		50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+		130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+		337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+		876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+		2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+		5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+		15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+	};
+	static const int8_t index_tab[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+	int32_t pred = 0, index = 0;
+
+	memset(codes, 0, (n+1)/2);
+	for (uint32_t k = 0; k < n; k++) {
+		int32_t step = step_tab[index];
+		int32_t diff = x[k] - pred;
+		uint32_t code = 0;
+		if (diff < 0) {code = 8; diff = -diff;}
+		// quantize with the same truncating steps the decoder adds up
+		if (diff >= step) {code |= 4; diff -= step;}
+		if (diff >= step >> 1) {code |= 2; diff -= step >> 1;}
+		if (diff >= step >> 2) code |= 1;
+		// track the decoder
+		int32_t dq = step >> 3;
+		if (code & 4) dq += step;
+		if (code & 2) dq += step >> 1;
+		if (code & 1) dq += step >> 2;
+		pred += (code & 8) ? -dq : dq;
+		if (pred > INT16_MAX) pred = INT16_MAX;
+		else if (pred < INT16_MIN) pred = INT16_MIN;
+		index += index_tab[code & 7];
+		if (index < 0) index = 0;
+		else if (index > 88) index = 88;
+		codes[k >> 1] |= code << ((k & 1) << 2);
+		xd[k] = pred;
+	}
+}
+
+// Signal to noise ratio in dB of y against the reference x.
+static double snr(const int16_t *x, const int16_t *y, uint32_t n)
+{
+	double sig = 0, err = 0;
+	for (uint32_t k = 0; k < n; k++) {
+		double e = (double)y[k] - x[k];
+		sig += (double)x[k] * x[k];
+		err += e * e;
+	}
+	return 10*log10(sig / (err ? err : 1));
+}
+
+// Encode a two tone clip to ADPCM as audio2adpcm.m does. Check that
+// adpcm_decode() reproduces the encoder's output exactly and is close to
+// the source PCM, then play the clip through sound_play_adpcm() and the
+// mixer and compare the output with the source too.
+static int32_t check_adpcm(void)
+{
+	static int16_t pcm[CLIP_N], xd[CLIP_N], dec[CLIP_N], out[CLIP_N + LAG_MAX];
+	static uint8_t codes[(CLIP_N+1)/2];
+	adpcm_state_t st;
+	int32_t err = 0;
+
+	for (uint32_t k = 0; k < CLIP_N; k++) {
+		double t = (double)k / SAMPLE_HZ;
+		pcm[k] = lrint(12000*sin(2*M_PI*440*t) + 9000*sin(2*M_PI*1250*t));
+	}
+	ima_encode(pcm, CLIP_N, codes, xd);
+	adpcm_reset(&st);
+	adpcm_decode(&st, codes, 0, dec, CLIP_N);
+	if (memcmp(dec, xd, sizeof(dec))) {
+		fprintf(stderr, "adpcm: decoder differs from the encoder's model\n");
+		err = -1;
+	}
+	double q = snr(pcm, dec, CLIP_N);
+	printf("adpcm: decoded SNR %.1f dB\n", q);
+	if (q < ADPCM_SNR_MIN) err = -1;
+
+	// Start recording before the voice, then line the output up with the
+	// source where they correlate best, to skip the output latency.
+	sound_set_volume(MAX_VOL);
+	sound_host_run(SETTLE_MS);
+	sound_host_record(out, CLIP_N + LAG_MAX);
+	sound_play_adpcm(codes, CLIP_N, 0, MAX_VOL, false, 1);
+	while (sound_host_recorded() < CLIP_N + LAG_MAX) sound_host_run(TONE_MS/10);
+	sound_host_record(NULL, 0);
+	sound_set_volume(VOL_DEMO);
+	uint32_t lag = 0;
+	double best = -INFINITY;
+	for (uint32_t d = 0; d < LAG_MAX; d++) {
+		double c = 0;
+		for (uint32_t k = 0; k < CLIP_N; k += 4) c += (double)pcm[k] * out[d+k];
+		if (c > best) {best = c; lag = d;}
+	}
+	q = snr(pcm, out + lag, CLIP_N);
+	printf("adpcm: played SNR %.1f dB, %u samples late\n", q, (unsigned)lag);
+	if (q < DAC_SNR_MIN) err = -1;
+	if (err) fprintf(stderr, "adpcm: check failed\n");
+	return err;
+}
+
+// Output samples a queued clip of n samples at hz plays for: one per
+// step of the resampler's Q16 phase until it passes the end of the last
+// sample, which is held for its full period.
+static uint32_t clip_len(uint32_t n, uint32_t hz)
+{
+	if (hz == 0 || hz == SAMPLE_HZ) return n;
+	uint32_t step = ((uint64_t)hz << 16) / SAMPLE_HZ;
+	return ((uint64_t)n << 16) / step + (((uint64_t)n << 16) % step != 0);
+}
+
+// Queue more clips than the queue holds, of odd lengths at mixed rates,
+// each at its own constant level, so the ring wraps as they play.
+// The output must hold one run per clip, of the clip's length, each
+// starting on the sample after the previous one ends, with no silence or
+// other level between them. Each clip must notify once. Then queue a clip
+// after the queue voice has ended, which has to restart it.
+static int32_t check_queue(void)
+{
+	static const struct {uint16_t n; uint16_t hz; uint8_t level;} c[] = {
+		{50, 0, 0xA0}, {77, SAMPLE_HZ/2, 0x60}, {300, 16000, 0xB8},
+		{1, 0, 0x48}, {129, 44100, 0xD0}, {33, 0, 0x30},
+		{77, 8000, 0x90}, {50, 30000, 0x70}, {300, 0, 0xC8},
+		{61, 11025, 0x58}, {3, 0, 0xE0}, {200, 0, 0x20},
+	};
+	enum {CLIPS = sizeof(c)/sizeof(c[0])};
+	static uint8_t audio[CLIPS][300];
+	static int16_t out[QUEUE_REC];
+	uint32_t run[CLIPS+1], runs = 0, i, k;
+	int32_t err = 0;
+
+	ulTaskNotifyTake(pdTRUE, 0);
+	sound_set_volume(MAX_VOL);
+	sound_host_run(SETTLE_MS);
+	sound_host_record(out, QUEUE_REC);
+	for (k = 0; k < CLIPS; k++) {
+		memset(audio[k], c[k].level, c[k].n);
+		sound_clip_t clip = {.audio = audio[k], .size = c[k].n, .hz = c[k].hz,
+			.notify = xTaskGetCurrentTaskHandle()};
+		uint32_t ms = 0; // once the queue is full, wait for a clip to start
+		for (; !sound_enqueue(&clip) && ms < HEAR_MS; ms++) sound_host_run(1);
+		if (ms == HEAR_MS) {
+			fprintf(stderr, "queue: clip %u not queued\n", (unsigned)k);
+			err = -1;
+		}
+	}
+	while (sound_host_recorded() < QUEUE_REC) sound_host_run(TONE_MS/10);
+	sound_host_record(NULL, 0);
+	uint32_t notes = ulTaskNotifyTake(pdTRUE, 0);
+	if (notes != CLIPS) {
+		fprintf(stderr, "queue: %u notifications for %u clips\n", (unsigned)notes, (unsigned)CLIPS);
+		err = -1;
+	}
+	if (sound_voice_busy(sound_queue_voice())) {
+		fprintf(stderr, "queue: voice still playing once empty\n");
+		err = -1;
+	}
+
+	// Split the output after the leading silence into runs of one level.
+	for (i = 0; i < QUEUE_REC && out[i] == out[0]; i++);
+	while (i < QUEUE_REC && out[i] != out[0] && runs <= CLIPS) {
+		for (k = i; k < QUEUE_REC && out[k] == out[i]; k++);
+		run[runs++] = k - i;
+		i = k;
+	}
+	if (runs != CLIPS) {
+		fprintf(stderr, "queue: %u runs of level for %u clips\n", (unsigned)runs, (unsigned)CLIPS);
+		err = -1;
+	}
+	for (k = 0; k < runs && k < CLIPS; k++) {
+		if (run[k] != clip_len(c[k].n, c[k].hz)) {
+			fprintf(stderr, "queue: clip %u played %u samples, not %u\n",
+				(unsigned)k, (unsigned)run[k], (unsigned)clip_len(c[k].n, c[k].hz));
+			err = -1;
+		}
+	}
+
+	sound_clip_t clip = {.audio = audio[0], .size = c[0].n,
+		.notify = xTaskGetCurrentTaskHandle()};
+	sound_host_listen();
+	if (!sound_enqueue(&clip)) err = -1;
+	for (uint32_t ms = 0; sound_host_heard() < 0 && ms < HEAR_MS; ms++) sound_host_run(1);
+	sound_host_run(TONE_MS);
+	if (sound_host_heard() < 0 || ulTaskNotifyTake(pdTRUE, 0) != 1) {
+		fprintf(stderr, "queue: clip after the queue ran empty not played\n");
+		err = -1;
+	}
+	sound_set_volume(VOL_DEMO);
+	printf("queue: %u clips played back to back\n", (unsigned)runs);
+	if (err) fprintf(stderr, "queue: check failed\n");
+	return err;
+}
+
+// Envelope level of a note t samples after its onset, out of one, worked
+// out from the ADSR times as tone.h describes them.
+static double env_level(const tone_env_t *e, uint32_t len, uint32_t t)
+{
+	double ms = 1000.0 * t / SAMPLE_HZ, rel = 1000.0 * len / SAMPLE_HZ / 2;
+	double gate, s = e->sustain / 100.0;
+
+	if (e->release_ms < rel) rel = e->release_ms;
+	gate = 1000.0 * len / SAMPLE_HZ - rel;
+	double at = (ms < gate) ? ms : gate, lvl;
+	if (at < e->attack_ms) lvl = at / e->attack_ms;
+	else if (at < e->attack_ms + e->decay_ms) lvl = 1 - (1-s) * (at - e->attack_ms) / e->decay_ms;
+	else lvl = s;
+	if (ms > gate) lvl *= 1 - (ms - gate) / rel;
+	return lvl;
+}
+
+// Play a pattern of sine notes, with and without rests between them, and
+// check the output sample by sample against the pattern. Each note without
+// an attack must leave silence on its tick sample, counted from the first
+// note. The pattern starts at phase zero, so the first note is found as the
+// sample before the first one heard. Over each period of a note, the
+// samples must reach the ADSR envelope and not exceed it, to within
+// ENV_TOL of full level, and the zero crossings must give the note's
+// frequency.
+static int32_t check_pattern(void)
+{
+	static const tone_env_t env[] = {
+		{.attack_ms = 0, .decay_ms = 30, .sustain = 50, .release_ms = 20},
+		{.attack_ms = 10, .decay_ms = 20, .sustain = 70, .release_ms = 30},
+		{.attack_ms = 0, .decay_ms = 0, .sustain = 100, .release_ms = 10},
+	};
+	static const tone_note_t tune[] = {
+		{60, SINE_T, 0, 4}, {TONE_REST, 0, 0, 1}, {64, SINE_T, 1, 4},
+		{TONE_REST, 0, 0, 1}, {67, SINE_T, 0, 3}, {72, SINE_T, 2, 2},
+		{57, SINE_T, 0, 1}, {TONE_END},
+	};
+	static int16_t out[PAT_REC];
+	const uint32_t tick = SAMPLE_HZ * TICK_MS / 1000;
+	int32_t err = 0;
+	uint32_t t0, at = 0, i, k;
+
+	sound_set_volume(MAX_VOL);
+	sound_host_run(SETTLE_MS);
+	sound_host_record(out, PAT_REC);
+	if (tone_play(tune, env, TICK_MS, false)) err = -1;
+	while (sound_host_recorded() < PAT_REC) sound_host_run(TONE_MS/10);
+	sound_host_record(NULL, 0);
+	for (i = 1; i < PAT_REC; i++) out[i] -= out[0];
+	out[0] = 0;
+	for (t0 = 1; t0 < PAT_REC && out[t0] == 0; t0++);
+	t0--;
+	int32_t full = 0;
+	for (i = 0; i < PAT_REC; i++) if (abs(out[i]) > full) full = abs(out[i]);
+	if (t0 == PAT_REC-1 || full == 0) {
+		fprintf(stderr, "pattern: not heard\n");
+		return -1;
+	}
+
+	printf("pattern: note onset (sample) freq (Hz)\n");
+	for (const tone_note_t *n = tune; n->note != TONE_END; at += n->ticks * tick, n++) {
+		if (n->note == TONE_REST) continue;
+		uint32_t on = t0 + at, len = n->ticks * tick;
+		const tone_env_t *e = env + n->env;
+		double f = 440 * pow(2, (n->note - 69) / 12.0);
+		if (on + len > PAT_REC) {
+			fprintf(stderr, "pattern: note %u not recorded\n", (unsigned)n->note);
+			return -1;
+		}
+		if (e->attack_ms == 0 && (out[on-1] != 0 || (out[on] == 0) != (on == t0))) {
+			fprintf(stderr, "pattern: note %u not on its tick at %u\n", (unsigned)n->note, (unsigned)at);
+			err = -1;
+		}
+
+		// Over each period, the sample furthest above the envelope is near
+		// the sine's peak, where it should meet the envelope.
+		uint32_t per = ceil(SAMPLE_HZ / f);
+		for (i = 0; i + per <= len; i += per) {
+			double over = -1, want = 0;
+			for (k = i; k < i + per; k++) {
+				double l = env_level(e, len, k), d = (double)abs(out[on+k]) / full - l;
+				if (d > over) {over = d; want = l;}
+			}
+			if (fabs(over) > ENV_TOL) {
+				fprintf(stderr, "pattern: note %u at %.1f ms is at %.2f, not %.2f\n",
+					(unsigned)n->note, 1000.0 * i / SAMPLE_HZ, want + over, want);
+				err = -1;
+				break;
+			}
+		}
+
+		// Upward zero crossings while the note is loud enough to time them
+		double first = -1, last = -1;
+		uint32_t cross = 0;
+		for (k = on + 1; k < on + len; k++) {
+			if (out[k-1] < 0 && out[k] >= 0 && env_level(e, len, k - on) > 0.25) {
+				double t = k - 1 + (double)-out[k-1] / (out[k] - out[k-1]);
+				if (first < 0) first = t;
+				last = t;
+				cross++;
+			}
+		}
+		double got = (cross > 1) ? (cross - 1) * SAMPLE_HZ / (last - first) : 0;
+		printf("%13u %6u %9.2f\n", (unsigned)n->note, (unsigned)at, got);
+		if (fabs(got - f) > FREQ_TOL * f) {
+			fprintf(stderr, "pattern: note %u at %.2f Hz, not %.2f Hz\n", (unsigned)n->note, got, f);
+			err = -1;
+		}
+	}
+	if (tone_play_busy()) {
+		fprintf(stderr, "pattern: still playing after the end\n");
+		err = -1;
+	}
+	sound_set_volume(VOL_DEMO);
+	if (err) fprintf(stderr, "pattern: check failed\n");
+	return err;
+}
+
+// Play a file through sound_stream_open() twice and compare the output
+// with the file, sample for sample. The blocks of the mixer don't divide
+// the stream's ring, so copies wrap round its end. The first time the
+// prefetch task keeps up and there must be no underruns. The second time
+// it is held back until the ring runs dry: the output must be the file
+// with silence inserted, and each block padded must count as an underrun.
+// dir: where to write the file.
+static int32_t check_stream(const char *dir)
+{
+	static uint8_t data[STREAM_N];
+	static int16_t out[STREAM_N + (HOLD_MS+SETTLE_MS)*SAMPLE_HZ/1000 + LAG_MAX];
+	const uint32_t rec_n = sizeof(out)/sizeof(out[0]);
+	char path[PATH_MAX];
+	sound_stats_t st;
+	int32_t err = 0;
+	uint32_t x = 1;
+
+	// The file never holds the silence level, so padding stands out.
+	for (uint32_t i = 0; i < STREAM_N; i++)
+		do data[i] = (x = x*1103515245 + 12345) >> 24; while (data[i] == 0x80);
+	if (realpath(dir, path) == NULL || strlen(path) + sizeof("/stream.u8") > sizeof(path)) return -1;
+	strcat(path, "/stream.u8");
+	FILE *f = fopen(path, "wb");
+	if (f == NULL || fwrite(data, 1, STREAM_N, f) != STREAM_N) {
+		fprintf(stderr, "can't write %s\n", path);
+		if (f) fclose(f);
+		return -1;
+	}
+	fclose(f);
+
+	sound_set_volume(MAX_VOL);
+	sound_set_latency(STREAM_LAT_MS);
+	for (uint32_t held = 0; held < 2; held++) {
+		sound_host_run(SETTLE_MS);
+		sound_reset_stats();
+		sound_host_record(out, rec_n);
+		sound_voice_t v = sound_stream_open(path, MAX_VOL, false, 1);
+		if (v < 0) {
+			err = -1;
+			break;
+		}
+		if (held) {
+			sound_host_run(SETTLE_MS);
+			sound_host_hold(true);
+			sound_host_run(HOLD_MS);
+			sound_host_hold(false);
+		}
+		while (sound_host_recorded() < rec_n) sound_host_run(TONE_MS/10);
+		sound_host_record(NULL, 0);
+		uint32_t under = sound_stream_underruns();
+		bool busy = sound_voice_busy(v);
+		sound_stream_close();
+		sound_get_stats(&st);
+
+		// Drop the silence and compare what is left with the file.
+		uint32_t n = 0, pad = 0, i;
+		for (i = 0; i < rec_n && out[i] == 0; i++);
+		for (; i < rec_n && n < STREAM_N; i++) {
+			if (out[i] == 0) pad++;
+			else if (out[i] != (data[n++] - 0x80) * 256) break;
+		}
+		printf("stream: %s, %u underruns, %u samples padded\n",
+			held ? "task held" : "task keeping up", (unsigned)under, (unsigned)pad);
+		if (n < STREAM_N || (i < rec_n && out[i] != 0) || busy) {
+			fprintf(stderr, "stream: output differs from the file at byte %u\n", (unsigned)n);
+			err = -1;
+		}
+		if (held ? (under == 0 || pad == 0 || st.padded != under) : (under || pad)) {
+			fprintf(stderr, "stream: %u underruns, %u blocks padded\n", (unsigned)under, (unsigned)st.padded);
+			err = -1;
+		}
+	}
+	sound_set_latency(0);
+	sound_set_volume(VOL_DEMO);
+	if (err) fprintf(stderr, "stream: check failed\n");
+	return err;
+}
+
+// In-place radix-2 FFT.
+// re, im: n complex values.
+// n: a power of 2.
+static void fft(double *re, double *im, uint32_t n)
+{
+	for (uint32_t i = 1, j = 0; i < n; i++) { // bit reversed order
+		uint32_t bit = n >> 1;
+		for (; j & bit; bit >>= 1) j ^= bit;
+		j |= bit;
+		if (i < j) {
+			double t = re[i]; re[i] = re[j]; re[j] = t;
+			t = im[i]; im[i] = im[j]; im[j] = t;
+		}
+	}
+	for (uint32_t len = 2; len <= n; len <<= 1) {
+		double a = -2*M_PI/len;
+		for (uint32_t i = 0; i < n; i += len) {
+			for (uint32_t k = 0; k < len/2; k++) {
+				double wr = cos(a*k), wi = sin(a*k);
+				double *ur = re+i+k, *ui = im+i+k, *vr = ur+len/2, *vi = ui+len/2;
+				double xr = *vr*wr - *vi*wi, xi = *vr*wi + *vi*wr;
+				*vr = *ur - xr; *vi = *ui - xi;
+				*ur += xr; *ui += xi;
+			}
+		}
+	}
+}
+
+// Play each band-limited waveform at a few frequencies and take a Hann
+// windowed DFT of the output. Energy away from the harmonic bins is
+// aliasing (and 8-bit quantization noise); it must stay ALIAS_MAX below
+// the harmonics. Naive tables reach -5 to -14 dB here.
+static int32_t check_alias(void)
+{
+	static const uint32_t freq[] = {1300, 3100, 5300};
+	static int16_t out[DFT_N];
+	static double re[DFT_N], im[DFT_N];
+	int32_t err = 0;
+
+	sound_set_volume(MAX_VOL);
+	for (tone_t t = SQUARE_T; t < LAST_T; t++) {
+		printf("alias: %-8s", tone_name[t]);
+		for (uint32_t f = 0; f < sizeof(freq)/sizeof(freq[0]); f++) {
+			tone_start(t, freq[f]);
+			sound_host_run(TONE_MS/10); // past the output latency
+			sound_host_record(out, DFT_N);
+			while (sound_host_recorded() < DFT_N) sound_host_run(TONE_MS/10);
+			sound_host_record(NULL, 0);
+			tone_stop();
+			for (uint32_t k = 0; k < DFT_N; k++) {
+				re[k] = out[k] * (0.5 - 0.5*cos(2*M_PI*k/DFT_N));
+				im[k] = 0;
+			}
+			fft(re, im, DFT_N);
+
+			double harm = 0, alias = 0;
+			for (uint32_t k = DC_BINS; k <= DFT_N/2; k++) {
+				double e = re[k]*re[k] + im[k]*im[k];
+				double h = (double)k * SAMPLE_HZ / DFT_N / freq[f]; // in harmonics
+				double off = fabs(h - lrint(h)) * freq[f] * DFT_N / SAMPLE_HZ; // in bins
+				if (lrint(h) >= 1 && off <= LOBE) harm += e;
+				else alias += e;
+			}
+			double db = 10*log10(alias / harm);
+			printf(" %u Hz %.1f dB", (unsigned)freq[f], db);
+			if (db > ALIAS_MAX) err = -1;
+		}
+		printf("\n");
+	}
+	sound_set_volume(VOL_DEMO);
+	if (err) fprintf(stderr, "alias: over %.0f dB\n", ALIAS_MAX);
+	return err;
+}
+
+// Measure the time from starting a click to its first sample at the
+// output, for several latency settings, at several phases against the
+// DMA blocks. The longest must not exceed the latency reported by
+// sound_set_latency(), nor fall below half of it, which would mean the
+// DMA buffers are not played in full.
+static int32_t measure_latency(void)
+{
+	static const uint32_t target_ms[] = {0, 2, 5, 10, 20, 50, 100, 500};
+	static const uint8_t click[] = {0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00};
+	int32_t err = 0;
+
+	printf("latency: target  set (us)  measured min-max (us)\n");
+	for (uint32_t t = 0; t < sizeof(target_ms)/sizeof(target_ms[0]); t++) {
+		uint32_t set = sound_set_latency(target_ms[t]);
+		uint64_t lo = UINT64_MAX, hi = 0;
+		for (uint32_t p = 0; p < PHASES; p++) {
+			sound_host_run(set/1000 + SETTLE_MS + p);
+			sound_host_listen();
+			sound_play(click, sizeof(click), 0, MAX_VOL, false, 1);
+			for (uint32_t ms = 0; sound_host_heard() < 0 && ms < HEAR_MS; ms++) sound_host_run(1);
+			if (sound_host_heard() < 0) {
+				fprintf(stderr, "click not heard at %u ms\n", (unsigned)target_ms[t]);
+				return -1;
+			}
+			uint64_t us = sound_host_heard() * 1000000ULL / SAMPLE_HZ;
+			if (us < lo) lo = us;
+			if (us > hi) hi = us;
+		}
+		printf("%16u %9u %10llu-%llu%s\n", (unsigned)target_ms[t], (unsigned)set,
+			(unsigned long long)lo, (unsigned long long)hi, (hi > set) ? " over" : (hi < set/2) ? " under" : "");
+		if (hi > set || hi < set/2) err = -1;
+	}
+	sound_set_latency(0);
+	return err;
+}
+#endif
+
+// Render each tone waveform, and a mixer demo, to WAV files for listening
+// to or comparing against a reference. Then check ADPCM playback against
+// its source, gapless playback of the clip queue, the timing, envelopes
+// and pitch of a pattern, streaming from a file with and without
+// underruns and the alias suppression of the tones, and measure the
+// output latency.
+// Usage: render [output directory]
+int main(int argc, char *argv[])
+{
+	const char *dir = (argc > 1) ? argv[1] : ".";
+	int32_t err;
+
+	if (tone_init(SAMPLE_HZ)) {
+		fprintf(stderr, "tone_init failed\n");
+		return EXIT_FAILURE;
+	}
+	err = render_tones(dir);
+#ifdef SOUND_ONESHOT
+	if (!err) err = render_cyclic(dir);
+#else
+	if (!err) err = render_pattern(dir, "pattern");
+	if (!err) err = render_fx(dir);
+	if (!err) err = render_mix(dir);
+	if (!err) err = check_adpcm();
+	if (!err) err = check_queue();
+	if (!err) err = check_pattern();
+	if (!err) err = check_stream(dir);
+	if (!err) err = check_alias();
+	if (!err) err = measure_latency();
+#endif
+	tone_deinit();
+	printf("%llu samples played\n", (unsigned long long)sound_host_samples());
+	return err ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,672 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+#include "esp_partition.h"
+#include "driver/gpio.h"
+#include "driver/dac_continuous.h"
+#include "driver/dac_oneshot.h"
+#include "driver/gptimer.h"
+#include "driver/i2s_std.h"
+
+#include "sound_host.h"
+
+#define WAV_HDR_SZ 44
+#define DAC_RESET 0 // DMA buffers are cleared to zero when writing starts
+
+struct dac_continuous_s {
+	dac_continuous_config_t cfg;
+	dac_event_callbacks_t cbs;
+	void *user_data;
+	uint8_t *bufs; // desc_num DMA buffers, played in turn
+	uint32_t *len; // bytes of each buffer the descriptor plays
+	uint32_t desc; // buffer playing
+	uint32_t pos; // next sample in it
+	bool running;
+};
+
+struct i2s_channel_s {
+	i2s_chan_config_t cfg;
+	i2s_std_config_t std;
+	i2s_event_callbacks_t cbs;
+	void *user_data;
+	int16_t *bufs; // dma_desc_num DMA buffers, sent in turn
+	uint32_t desc; // buffer sending
+	uint32_t pos; // next frame in it
+	bool running;
+};
+
+struct dac_oneshot_s {
+	uint8_t value;
+};
+
+struct gptimer_s {
+	gptimer_config_t cfg;
+	gptimer_event_callbacks_t cbs;
+	void *user_data;
+	uint64_t alarm_count;
+	bool running;
+};
+
+static struct dac_continuous_s *cont;
+static struct i2s_channel_s *i2s;
+static struct dac_oneshot_s *one;
+static struct gptimer_s *timer;
+
+static void run_tasks(void);
+static FILE *wav;
+static uint32_t wav_hz, wav_bytes;
+static uint32_t wav_bits; // 16 for I2S, 8 for the DAC
+static uint64_t samples;
+static uint64_t frac; // sample clock remainder, in Hz*ms
+static uint64_t clock_ms; // virtual time advanced by sound_host_run()
+static int32_t last; // last sample emitted
+static int32_t quiet; // level taken as silence by sound_host_listen()
+static uint64_t listen_at; // samples played when listening started
+static int64_t heard = -1; // samples until the output left quiet, or -1
+static int16_t *rec; // where to record samples, or NULL
+static uint32_t rec_n, rec_len; // samples recorded, and wanted
+
+
+// Write a 32-bit little endian value.
+static void put32(uint8_t *p, uint32_t v)
+{
+	for (uint32_t i = 0; i < 4; i++) p[i] = v >> 8*i;
+}
+
+// Write the RIFF header for the data written so far.
+static void wav_header(void)
+{
+	uint8_t h[WAV_HDR_SZ];
+	memcpy(h, "RIFF\0\0\0\0WAVEfmt ", 16);
+	put32(h+4, WAV_HDR_SZ-8 + wav_bytes);
+	put32(h+16, 16); // fmt chunk size
+	put32(h+20, 1 | 1<<16); // PCM, mono
+	put32(h+24, wav_hz);
+	put32(h+28, wav_hz * wav_bits/8); // bytes per second
+	put32(h+32, wav_bits/8 | wav_bits<<16); // block align, bits per sample
+	memcpy(h+36, "data", 4);
+	put32(h+40, wav_bytes);
+	fseek(wav, 0, SEEK_SET);
+	fwrite(h, 1, sizeof(h), wav);
+	fseek(wav, 0, SEEK_END);
+}
+
+// Record one sample reaching the DAC, or a signed 16-bit sample sent
+// over I2S.
+static void emit(int32_t v, uint32_t hz)
+{
+	if (heard < 0 && v != quiet) heard = samples - listen_at;
+	if (rec && rec_n < rec_len)
+		rec[rec_n++] = (i2s && i2s->running) ? v : (v - 0x80) * 256;
+	last = v;
+	samples++;
+	if (wav == NULL) return;
+	if (wav_bytes == 0) wav_hz = hz;
+	fputc(v, wav);
+	if (wav_bits == 16) fputc(v >> 8, wav);
+	wav_bytes += wav_bits/8;
+}
+
+// Return the current sample rate of the active driver, or 0 if none.
+static uint32_t rate(void)
+{
+	if (cont && cont->running) return cont->cfg.freq_hz;
+	if (i2s && i2s->running) return i2s->std.clk_cfg.sample_rate_hz;
+	if (timer && timer->running && timer->alarm_count)
+		return timer->cfg.resolution_hz / timer->alarm_count;
+	return 0;
+}
+
+// Play one sample period.
+static void tick(void)
+{
+	if (cont && cont->running) {
+		size_t sz = cont->cfg.buf_size;
+		uint8_t *buf = cont->bufs + cont->desc*sz;
+		emit(buf[cont->pos], cont->cfg.freq_hz);
+		if (++cont->pos >= cont->len[cont->desc]) { // buffer played out, hand it back
+			dac_event_data_t ev = {.buf = buf, .buf_size = sz, .write_bytes = cont->len[cont->desc]};
+			cont->pos = 0;
+			cont->desc = (cont->desc+1) % cont->cfg.desc_num;
+			if (cont->cbs.on_convert_done)
+				cont->cbs.on_convert_done(cont, &ev, cont->user_data);
+			run_tasks();
+		}
+	} else if (i2s && i2s->running) {
+		uint32_t n = i2s->cfg.dma_frame_num;
+		int16_t *buf = i2s->bufs + i2s->desc*n;
+		emit(buf[i2s->pos], rate());
+		if (++i2s->pos == n) { // buffer sent, it is sent again after the others
+			i2s_event_data_t ev = {.dma_buf = buf, .size = n*sizeof(buf[0])};
+			i2s->pos = 0;
+			i2s->desc = (i2s->desc+1) % i2s->cfg.dma_desc_num;
+			if (i2s->cbs.on_sent) i2s->cbs.on_sent(i2s, &ev, i2s->user_data);
+			if (i2s->cfg.auto_clear) memset(buf, 0, ev.size);
+			run_tasks();
+		}
+	} else if (timer && timer->running) {
+		gptimer_alarm_event_data_t ev = {.count_value = timer->alarm_count, .alarm_value = timer->alarm_count};
+		if (timer->cbs.on_alarm) timer->cbs.on_alarm(timer, &ev, timer->user_data);
+		run_tasks();
+		emit(one ? one->value : 0, rate());
+	}
+}
+
+// Start writing the DAC output to a WAV file (8-bit mono, at the DAC
+// sample rate), or the I2S output (16-bit mono). Closes a file already
+// open.
+// path: WAV file name.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_host_wav_open(const char *path)
+{
+	sound_host_wav_close();
+	wav = fopen(path, "wb");
+	if (wav == NULL) return -1;
+	wav_bytes = 0;
+	wav_hz = rate();
+	wav_bits = (i2s && i2s->running) ? 16 : 8;
+	wav_header();
+	return 0;
+}
+
+// Finish and close the WAV file.
+void sound_host_wav_close(void)
+{
+	if (wav == NULL) return;
+	wav_header();
+	fclose(wav);
+	wav = NULL;
+}
+
+// Advance the virtual clock, playing out the DAC.
+// ms: time to advance in milliseconds.
+void sound_host_run(uint32_t ms)
+{
+	uint32_t hz = rate();
+
+	clock_ms += ms;
+	if (hz == 0) {
+		run_tasks();
+		return;
+	}
+	frac += (uint64_t)hz * ms;
+	while (frac >= 1000) {
+		frac -= 1000;
+		tick();
+	}
+	run_tasks();
+}
+
+// Return the number of samples played out by the DAC since start.
+uint64_t sound_host_samples(void)
+{
+	return samples;
+}
+
+// Start listening for sound: the level of the last sample played is
+// taken as silence, and the first sample after now that differs from it
+// is reported by sound_host_heard().
+void sound_host_listen(void)
+{
+	quiet = last;
+	listen_at = samples;
+	heard = -1;
+}
+
+// Return the number of samples played from sound_host_listen() up to the
+// first sample away from silence, or -1 if none yet.
+int64_t sound_host_heard(void)
+{
+	return heard;
+}
+
+// Record the next samples played as signed 16-bit values. DAC samples
+// are centered and scaled by 256, I2S samples are kept as sent.
+// buf: where to put the samples, or NULL to stop recording.
+// n: the most samples to record.
+void sound_host_record(int16_t *buf, uint32_t n)
+{
+	rec = buf;
+	rec_n = 0;
+	rec_len = buf ? n : 0;
+}
+
+// Return the number of samples recorded since sound_host_record().
+uint32_t sound_host_recorded(void)
+{
+	return rec_n;
+}
+
+//----------------------------------------------------------------------------//
+// Driver stand-ins
+
+esp_err_t dac_continuous_new_channels(const dac_continuous_config_t *cfg, dac_continuous_handle_t *handle)
+{
+	struct dac_continuous_s *d = calloc(1, sizeof(*d));
+	if (d == NULL) return ESP_FAIL;
+	d->cfg = *cfg;
+	d->bufs = malloc(cfg->desc_num * cfg->buf_size);
+	d->len = malloc(cfg->desc_num * sizeof(d->len[0]));
+	if (d->bufs == NULL || d->len == NULL) {
+		free(d->bufs);
+		free(d->len);
+		free(d);
+		return ESP_FAIL;
+	}
+	cont = *handle = d;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_del_channels(dac_continuous_handle_t handle)
+{
+	free(handle->bufs);
+	free(handle->len);
+	free(handle);
+	if (cont == handle) cont = NULL;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_enable(dac_continuous_handle_t handle)
+{
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_disable(dac_continuous_handle_t handle)
+{
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_register_event_callback(dac_continuous_handle_t handle,
+	const dac_event_callbacks_t *callbacks, void *user_data)
+{
+	handle->cbs = *callbacks;
+	handle->user_data = user_data;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_start_async_writing(dac_continuous_handle_t handle)
+{
+	memset(handle->bufs, DAC_RESET, handle->cfg.desc_num * handle->cfg.buf_size);
+	for (uint32_t i = 0; i < handle->cfg.desc_num; i++) handle->len[i] = handle->cfg.buf_size;
+	handle->desc = handle->pos = 0;
+	handle->running = true;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_stop_async_writing(dac_continuous_handle_t handle)
+{
+	handle->running = false;
+	return ESP_OK;
+}
+
+esp_err_t dac_continuous_write_asynchronously(dac_continuous_handle_t handle,
+	uint8_t *dma_buf, size_t dma_buf_len, const uint8_t *data, size_t data_len,
+	size_t *bytes_loaded)
+{
+	// As in IDF, only the start of a DMA buffer is accepted, and the
+	// descriptor then plays just the bytes loaded.
+	uint32_t i = 0;
+	while (i < handle->cfg.desc_num && dma_buf != handle->bufs + i*handle->cfg.buf_size) i++;
+	if (i == handle->cfg.desc_num) return ESP_ERR_NOT_FOUND;
+	size_t n = (data_len < dma_buf_len) ? data_len : dma_buf_len;
+	memcpy(dma_buf, data, n);
+	handle->len[i] = n;
+	if (bytes_loaded) *bytes_loaded = n;
+	return ESP_OK;
+}
+
+esp_err_t i2s_new_channel(const i2s_chan_config_t *chan_cfg,
+	i2s_chan_handle_t *ret_tx_handle, i2s_chan_handle_t *ret_rx_handle)
+{
+	struct i2s_channel_s *c = calloc(1, sizeof(*c));
+	if (c == NULL || ret_tx_handle == NULL) {
+		free(c);
+		return ESP_FAIL;
+	}
+	c->cfg = *chan_cfg;
+	c->bufs = calloc(chan_cfg->dma_desc_num * chan_cfg->dma_frame_num, sizeof(c->bufs[0]));
+	if (c->bufs == NULL) {
+		free(c);
+		return ESP_FAIL;
+	}
+	i2s = *ret_tx_handle = c;
+	return ESP_OK;
+}
+
+esp_err_t i2s_del_channel(i2s_chan_handle_t handle)
+{
+	free(handle->bufs);
+	free(handle);
+	if (i2s == handle) i2s = NULL;
+	return ESP_OK;
+}
+
+esp_err_t i2s_channel_init_std_mode(i2s_chan_handle_t handle, const i2s_std_config_t *std_cfg)
+{
+	if (std_cfg->slot_cfg.data_bit_width != I2S_DATA_BIT_WIDTH_16BIT ||
+		std_cfg->slot_cfg.slot_mode != I2S_SLOT_MODE_MONO) return ESP_FAIL; // only 16-bit mono
+	handle->std = *std_cfg;
+	return ESP_OK;
+}
+
+esp_err_t i2s_channel_register_event_callback(i2s_chan_handle_t handle,
+	const i2s_event_callbacks_t *callbacks, void *user_data)
+{
+	handle->cbs = *callbacks;
+	handle->user_data = user_data;
+	return ESP_OK;
+}
+
+esp_err_t i2s_channel_enable(i2s_chan_handle_t handle)
+{
+	handle->desc = handle->pos = 0;
+	handle->running = true;
+	return ESP_OK;
+}
+
+esp_err_t i2s_channel_disable(i2s_chan_handle_t handle)
+{
+	handle->running = false;
+	return ESP_OK;
+}
+
+esp_err_t dac_oneshot_new_channel(const dac_oneshot_config_t *cfg, dac_oneshot_handle_t *handle)
+{
+	one = *handle = calloc(1, sizeof(**handle));
+	return one ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t dac_oneshot_del_channel(dac_oneshot_handle_t handle)
+{
+	free(handle);
+	if (one == handle) one = NULL;
+	return ESP_OK;
+}
+
+esp_err_t dac_oneshot_output_voltage(dac_oneshot_handle_t handle, uint8_t digi_value)
+{
+	handle->value = digi_value;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *cfg, gptimer_handle_t *handle)
+{
+	struct gptimer_s *t = calloc(1, sizeof(*t));
+	if (t == NULL) return ESP_FAIL;
+	t->cfg = *cfg;
+	timer = *handle = t;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_del_timer(gptimer_handle_t handle)
+{
+	free(handle);
+	if (timer == handle) timer = NULL;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t handle,
+	const gptimer_event_callbacks_t *cbs, void *user_data)
+{
+	handle->cbs = *cbs;
+	handle->user_data = user_data;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t handle, const gptimer_alarm_config_t *cfg)
+{
+	handle->alarm_count = cfg->alarm_count;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t handle)
+{
+	return ESP_OK;
+}
+
+esp_err_t gptimer_disable(gptimer_handle_t handle)
+{
+	return ESP_OK;
+}
+
+esp_err_t gptimer_start(gptimer_handle_t handle)
+{
+	handle->running = true;
+	return ESP_OK;
+}
+
+esp_err_t gptimer_stop(gptimer_handle_t handle)
+{
+	handle->running = false;
+	return ESP_OK;
+}
+
+esp_err_t gpio_config(const gpio_config_t *cfg)
+{
+	return ESP_OK;
+}
+
+esp_err_t gpio_set_level(int gpio, uint32_t level)
+{
+	return ESP_OK;
+}
+
+esp_cpu_cycle_count_t esp_cpu_get_cycle_count(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec*1000000000ULL + ts.tv_nsec;
+}
+
+// Virtual time, exact to the sample being played.
+int64_t esp_timer_get_time(void)
+{
+	uint32_t hz = rate();
+	return clock_ms*1000 - (hz ? (frac*1000 + hz/2) / hz : 0);
+}
+
+//----------------------------------------------------------------------------//
+// Task stand-ins
+//
+// Each task runs on a thread, but only while the code driving the clock
+// waits for it: after each DMA refill (or timer alarm) and each advance of
+// the clock, the tasks notified or past their timeout run until they block
+// again, as tasks that keep up do on the target. The audio code never runs
+// at the same time as a task, so critical sections can still do nothing.
+// sound_host_hold() keeps the tasks blocked, to make them fall behind.
+
+#define TASKS_MAX 4
+
+typedef struct {
+	void (*fn)(void *);
+	void *arg;
+	uint32_t notified; // notifications not yet taken
+	uint64_t wake_ms; // clock_ms to wake at, if not notified first
+	bool take; // waiting in ulTaskNotifyTake(), rather than vTaskDelay()
+	bool blocked;
+	bool used;
+} task_t;
+
+static task_t tasks[TASKS_MAX];
+static uint32_t live; // tasks started and not yet deleted
+static bool hold; // keep the tasks blocked
+static pthread_mutex_t task_mx = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t task_cv = PTHREAD_COND_INITIALIZER; // a task blocked or woke
+static __thread task_t *self; // task of this thread, NULL on the main thread
+static uint32_t notified; // notifications of the main thread
+
+// Return true if a blocked task may run. Call with task_mx held.
+static bool task_ready(const task_t *t)
+{
+	return !hold && ((t->take && t->notified) || clock_ms >= t->wake_ms);
+}
+
+// Wake the tasks that may run, and wait until they have all blocked again.
+static void run_tasks(void)
+{
+	if (live == 0) return;
+	pthread_mutex_lock(&task_mx);
+	for (task_t *t = tasks; t < tasks + TASKS_MAX; t++)
+		if (t->used && t->blocked && task_ready(t)) t->blocked = false;
+	pthread_cond_broadcast(&task_cv);
+	for (task_t *t = tasks; t < tasks + TASKS_MAX; ) {
+		if (t->used && !t->blocked) {
+			pthread_cond_wait(&task_cv, &task_mx);
+			t = tasks;
+		} else {
+			t++;
+		}
+	}
+	pthread_mutex_unlock(&task_mx);
+}
+
+// Block the calling task until ticks have passed on the clock or, if take
+// is set, it is notified. Call with task_mx held.
+static void task_block(TickType_t ticks, bool take)
+{
+	self->wake_ms = (ticks == portMAX_DELAY) ? UINT64_MAX : clock_ms + ticks*portTICK_PERIOD_MS;
+	self->take = take;
+	if (task_ready(self)) return;
+	self->blocked = true;
+	pthread_cond_broadcast(&task_cv);
+	while (self->blocked) pthread_cond_wait(&task_cv, &task_mx);
+}
+
+static void *task_main(void *arg)
+{
+	self = arg;
+	self->fn(self->arg);
+	vTaskDelete(NULL); // a task function must not return
+	return NULL;
+}
+
+// Keep the tasks blocked, or let them run again.
+// on: true to hold the tasks.
+void sound_host_hold(bool on)
+{
+	pthread_mutex_lock(&task_mx);
+	hold = on;
+	pthread_mutex_unlock(&task_mx);
+	if (!on) run_tasks();
+}
+
+// The delay runs the virtual clock instead of sleeping, unless called from
+// a task.
+void vTaskDelay(TickType_t ticks)
+{
+	if (self == NULL) {
+		sound_host_run(ticks * portTICK_PERIOD_MS);
+		return;
+	}
+	pthread_mutex_lock(&task_mx);
+	task_block(ticks, false);
+	pthread_mutex_unlock(&task_mx);
+}
+
+// Start the task and run it until it first blocks.
+BaseType_t xTaskCreate(void (*fn)(void *), const char *name, uint32_t stack,
+	void *arg, UBaseType_t prio, TaskHandle_t *handle)
+{
+	task_t *t = tasks;
+	pthread_t th;
+
+	while (t < tasks + TASKS_MAX && t->used) t++;
+	if (t == tasks + TASKS_MAX) return pdFALSE;
+	pthread_mutex_lock(&task_mx);
+	*t = (task_t){.fn = fn, .arg = arg, .used = true};
+	if (pthread_create(&th, NULL, task_main, t)) {
+		t->used = false;
+		pthread_mutex_unlock(&task_mx);
+		return pdFALSE;
+	}
+	pthread_detach(th);
+	live++;
+	pthread_mutex_unlock(&task_mx);
+	if (handle) *handle = t;
+	run_tasks();
+	return pdPASS;
+}
+
+// Only a task deleting itself is supported.
+void vTaskDelete(TaskHandle_t handle)
+{
+	if (self == NULL || (handle != NULL && handle != self)) return;
+	pthread_mutex_lock(&task_mx);
+	self->used = false;
+	live--;
+	pthread_cond_broadcast(&task_cv);
+	pthread_mutex_unlock(&task_mx);
+	pthread_exit(NULL);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+	return self ? (TaskHandle_t)self : (TaskHandle_t)&samples; // any non-NULL handle
+}
+
+// Count a notification for a task, or for the main thread.
+static void notify(TaskHandle_t handle)
+{
+	uintptr_t h = (uintptr_t)handle;
+
+	if (h < (uintptr_t)tasks || h >= (uintptr_t)(tasks + TASKS_MAX)) {
+		notified++;
+		return;
+	}
+	pthread_mutex_lock(&task_mx);
+	((task_t *)handle)->notified++;
+	pthread_mutex_unlock(&task_mx);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle)
+{
+	notify(handle);
+	return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t handle, BaseType_t *woken)
+{
+	notify(handle);
+	if (woken) *woken = pdTRUE;
+}
+
+// The main thread never waits, it takes the notifications given so far.
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait)
+{
+	uint32_t *cnt = &notified;
+
+	if (self) {
+		pthread_mutex_lock(&task_mx);
+		task_block(wait, true);
+		cnt = &self->notified;
+	}
+	uint32_t n = *cnt;
+	*cnt = clear ? 0 : (n ? n-1 : 0);
+	if (self) pthread_mutex_unlock(&task_mx);
+	return n;
+}
+
+// There are no partitions on the host.
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+	esp_partition_subtype_t subtype, const char *label)
+{
+	return NULL;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *part, size_t offset, size_t size,
+	esp_partition_mmap_memory_t memory, const void **out_ptr,
+	esp_partition_mmap_handle_t *out_handle)
+{
+	return ESP_ERR_NOT_FOUND;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle)
+{
+}
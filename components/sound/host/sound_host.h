@@ -0,0 +1,71 @@
+#ifndef SOUND_HOST_H_
+#define SOUND_HOST_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// This is a host (Linux) backend for the sound component. It stands in
+// for the DAC and I2S drivers with a virtual clock: the DMA driver's refill
+// callback (sound_cont.c) is called each time a DMA buffer has played
+// out, and the timer driver's ISR (sound_one.c) on each alarm, exactly as
+// the hardware would. The samples reaching the DAC (or I2S) go to a WAV
+// file, so output can be compared bit-exactly and timed on a PC.
+// vTaskDelay() advances the clock, so sound_start(..., true) works.
+// Tasks, such as the stream prefetch task, run on threads in step with the
+// clock: after each refill they run until they block (see sound_host.c).
+//
+// Build from the repository root, for example:
+//   gcc -O2 -Icomponents/sound/host/include -Icomponents/sound -Icomponents/config -Icomponents/tone
+//     components/sound/host/render.c components/sound/host/sound_host.c
+//     components/sound/sound_cont.c components/sound/sound_fx.c components/sound/adpcm.c
+//     components/sound/sound_stream.c components/tone/tone.c -lm -pthread -o render
+// Build the timer driver with sound_one.c in place of sound_cont.c,
+// sound_fx.c, adpcm.c and sound_stream.c, adding -DSOUND_ONESHOT. Add
+// -DHW_TARGET_LTAG with sound_cont.c to build the I2S output of the LTAG
+// board instead of the DAC.
+// bench.c in place of render.c (and without tone.c) times the audio
+// kernels instead.
+// The WAV files can be analyzed with audio/plot_spectrum.m and
+// audio/plot_time.m like the source clips.
+
+// Start writing the DAC output to a WAV file (8-bit mono, at the DAC
+// sample rate), or the I2S output (16-bit mono). Closes a file already
+// open.
+// path: WAV file name.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_host_wav_open(const char *path);
+
+// Finish and close the WAV file.
+void sound_host_wav_close(void);
+
+// Advance the virtual clock, playing out the DAC.
+// ms: time to advance in milliseconds.
+void sound_host_run(uint32_t ms);
+
+// Return the number of samples played out by the DAC since start.
+uint64_t sound_host_samples(void);
+
+// Start listening for sound: the level of the last sample played is
+// taken as silence, and the first sample after now that differs from it
+// is reported by sound_host_heard().
+void sound_host_listen(void);
+
+// Return the number of samples played from sound_host_listen() up to the
+// first sample away from silence, or -1 if none yet.
+int64_t sound_host_heard(void);
+
+// Record the next samples played as signed 16-bit values. DAC samples
+// are centered and scaled by 256, I2S samples are kept as sent.
+// buf: where to put the samples, or NULL to stop recording.
+// n: the most samples to record.
+void sound_host_record(int16_t *buf, uint32_t n);
+
+// Return the number of samples recorded since sound_host_record().
+uint32_t sound_host_recorded(void);
+
+// Keep the tasks blocked, as if higher priority work kept them from
+// running, or let them run again.
+// on: true to hold the tasks.
+void sound_host_hold(bool on);
+
+#endif // SOUND_HOST_H_
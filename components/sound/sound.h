@@ -4,10 +4,128 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h" // TaskHandle_t
+
 #define MAX_VOL 100U
 
+// Number of voices mixed by the DMA driver (sound_cont.c). Each voice plays
+// its own buffer with its own volume, so a sound effect no longer cuts off
+// the music. A voice may have its own sample rate, converted to the output
+// rate given to sound_init(), so set that once to the highest rate used.
+// The voice functions below are only provided by that driver.
+#define SOUND_VOICES 8
+
+// Handle of a playing voice. Negative if no voice was allocated.
+// A handle goes stale when its voice finishes or is stolen, after which
+// the voice functions ignore it.
+typedef int32_t sound_voice_t;
+
+// Number of clips the queue can hold, a power of 2.
+#define SOUND_QUEUE_LEN 8
+
+// A clip for the queue.
+typedef struct {
+	const void *audio; // unsigned 8-bit samples, or IMA ADPCM codes
+	uint32_t size; // size in bytes, or number of samples if adpcm
+	uint32_t hz; // sample rate in Hz, or 0 for the output rate
+	bool adpcm; // audio holds IMA ADPCM codes (audio/audio2adpcm.m)
+	TaskHandle_t notify; // task to notify (xTaskNotifyGive) when the clip
+	                     // has played to its end, or NULL
+} sound_clip_t;
+
+// Source of samples for a voice, called from the audio ISR once per DMA
+// block. It must be placed in IRAM and must not block.
+// ctx: context given to sound_play_source().
+// buf: where to put unsigned audio samples.
+// len: number of samples wanted.
+// Return the number of samples written. Fewer than len ends the voice.
+// A source that runs dry should pad with silence and call sound_underrun().
+typedef uint32_t (*sound_fill_t)(void *ctx, uint8_t *buf, uint32_t len);
+
+// Longest asset name, including the terminating NUL.
+#define SOUND_ASSET_NAME 16
+
+// Index entry of an asset blob (audio/audio2pack.py), read in place from
+// flash. All fields are little endian.
+typedef struct {
+	char name[SOUND_ASSET_NAME]; // NUL padded, entries sorted by name
+	uint32_t offset; // of the samples from the start of the blob
+	uint32_t size; // number of unsigned 8-bit samples
+	uint32_t hz; // sample rate in Hz
+	uint32_t loop_start; // first sample of the loop
+	uint32_t loop_end; // sample after the loop, or zero if none
+} sound_asset_t;
+
+// Number of refill events kept for sound_get_events().
+#define SOUND_EVENTS 32
+
+// Refill event flags
+#define SOUND_EV_LATE   0x01 // over 1.5 block periods after the previous refill
+#define SOUND_EV_PADDED 0x02 // a source padded the block with silence
+#define SOUND_EV_IDLE   0x04 // no voice playing, silence written
+
+// Most effects in the output chain.
+#define SOUND_FX_MAX 4
+
+// Output effects
+typedef enum {
+	SOUND_FX_LPF, // 2-pole low-pass filter (biquad)
+	SOUND_FX_ECHO, // delay line with feedback, at most one per chain
+	SOUND_FX_LIMIT, // soft limiter, at most one per chain
+} sound_fx_type_t;
+
+// An effect of the output chain.
+typedef struct {
+	sound_fx_type_t type;
+	uint32_t budget; // CPU cycles allowed per DMA block, or 0 for no limit
+	union {
+		struct {
+			uint32_t cutoff_hz; // -3 dB frequency
+			uint32_t q100; // Q factor times 100, 71 for a flat pass band
+		} lpf;
+		struct {
+			uint32_t delay_ms; // up to SOUND_FX_ECHO_LEN samples
+			uint8_t feedback; // 0-99% of the echo fed back into the line
+			uint8_t mix; // 0-100% of the echo added to the output
+		} echo;
+		struct {
+			uint8_t threshold; // 0-100% of full scale where limiting starts
+		} limit;
+	};
+} sound_fx_t;
+
+// Samples in the echo delay line, a power of 2.
+#define SOUND_FX_ECHO_LEN 4096
+
+// Cost of an effect, since its chain was set.
+typedef struct {
+	uint32_t max_cycles; // most CPU cycles spent on one DMA block
+	uint32_t over; // DMA blocks that took more than the budget
+} sound_fx_stats_t;
+
+// Audio DMA refill counters, since sound_init() or sound_reset_stats().
+typedef struct {
+	uint32_t refills; // DMA blocks written
+	uint32_t late; // refills over 1.5 block periods after the previous one
+	uint32_t padded; // blocks padded with silence by a source that ran dry
+	uint32_t max_cycles; // most CPU cycles spent in one refill
+	uint32_t max_gap_us; // longest time between refills
+} sound_stats_t;
+
+// A refill of a DMA block by the audio ISR.
+typedef struct {
+	uint32_t us; // time of the refill (esp_timer_get_time(), low 32 bits)
+	uint32_t gap_us; // time since the previous refill
+	uint32_t cycles; // CPU cycles spent in the refill
+	uint8_t voices; // voices playing
+	uint8_t flags; // SOUND_EV_ flags
+} sound_event_t;
+
 // Initialize the sound driver. Must be called before using sound.
-// May be called again to change sample rate.
+// May be called again to change sample rate. The mixer drives the DAC on
+// GPIO26 with 8-bit samples, or with HW_TARGET_LTAG (ESP32-S3, no DAC) an
+// I2S amplifier with 16-bit samples.
 // sample_hz: sample rate in Hz to playback audio.
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_init(uint32_t sample_hz);
@@ -16,28 +134,205 @@ int32_t sound_init(uint32_t sample_hz);
 // Return zero if successful, or non-zero otherwise.
 int32_t sound_deinit(void);
 
-// Start playing the sound immediately. Play the audio buffer once.
+// Set the output latency: the longest time from starting a voice to its
+// first sample leaving the DAC (or I2S), which is the audio held in the
+// DMA buffers. The descriptor count and size are recomputed for the
+// sample rate and the channel is rebuilt, staying in async mode, while
+// the voices carry on. A short latency suits sound effects that follow
+// input, a long one fewer refills and more slack for a late refill.
+// ms: latency in milliseconds, or zero for the default sizing. Kept by
+// sound_init().
+// Return the latency achieved in microseconds, or zero before sound_init().
+uint32_t sound_set_latency(uint32_t ms);
+
+// Return the output latency in microseconds (see sound_set_latency()),
+// or zero before sound_init().
+uint32_t sound_get_latency(void);
+
+// Start playing the sound immediately on the main voice, replacing the
+// last buffer given to sound_start() or sound_cyclic(). Play it once.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait);
 
-// Cyclically play samples from audio buffer until sound_stop() is called.
+// Cyclically play samples from audio buffer on the main voice until
+// sound_stop() is called.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size);
 
-// Return true if sound playing, otherwise return false.
+// Return true if sound playing (on any voice), otherwise return false.
 bool sound_busy(void);
 
-// Stop playing the sound.
+// Stop playing the sound (all voices) and empty the clip queue.
 void sound_stop(void);
 
-// Set the volume.
+// Play the audio buffer on a free voice. If all voices are busy, the voice
+// with the lowest priority not above prio is stolen, the oldest one first.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+// hz: sample rate of the audio in Hz, or 0 for the output rate. Other
+// rates, up to 8 times the output rate, are resampled linearly.
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play cyclically until stopped, otherwise play once.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play(const void *audio, uint32_t size, uint32_t hz, uint32_t vol, bool loop, uint8_t prio);
+
+// Play the audio buffer on a free voice like sound_play(), once from
+// the start, then cyclically from loop_start until stopped.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes, the end of the loop.
+// hz: sample rate of the audio in Hz, or 0 for the output rate.
+// loop_start: index of the sample where the loop starts.
+// vol: voice volume 0-100% as an integer value.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play_loop(const void *audio, uint32_t size, uint32_t hz, uint32_t loop_start, uint32_t vol, uint8_t prio);
+
+// Play an IMA ADPCM clip, made by audio/audio2adpcm.m, on a free voice,
+// stealing one like sound_play() if needed. The clip is decoded block by
+// block in the audio ISR.
+// adpcm: a pointer to the clip's 4-bit codes.
+// samples: the number of samples (twice the size of the array in bytes).
+// hz: sample rate of the audio in Hz, or 0 for the output rate. Other
+// rates, up to 8 times the output rate, are resampled linearly.
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play cyclically until stopped, otherwise play once.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play_adpcm(const void *adpcm, uint32_t samples, uint32_t hz, uint32_t vol, bool loop, uint8_t prio);
+
+// Play samples produced by a source function on a free voice, stealing one
+// like sound_play() if needed. The voice ends when the source returns fewer
+// samples than asked for, or when stopped.
+// fill: source function, called from the audio ISR once per DMA block.
+// ctx: context passed to fill.
+// vol: voice volume 0-100% as an integer value.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play_source(sound_fill_t fill, void *ctx, uint32_t vol, uint8_t prio);
+
+// Queue a clip to play after the clips queued before it, with no gap: the
+// next clip starts on the sample after the previous one ends, even in the
+// middle of a DMA block. The queue plays on its own voice at the highest
+// priority, started as needed. Safe to call from several tasks.
+// clip: the clip, copied into the queue.
+// Return true if queued, or false if the queue is full.
+bool sound_enqueue(const sound_clip_t *clip);
+
+// Return the handle of the voice playing the clip queue, for example to
+// set its volume. The handle is stale once the queue runs empty.
+sound_voice_t sound_queue_voice(void);
+
+// Stop a voice. Stale handles are ignored.
+// voice: handle returned by sound_play().
+void sound_voice_stop(sound_voice_t voice);
+
+// Set the volume of a voice. Stale handles are ignored.
+// voice: handle returned by sound_play().
+// vol: 0-100% as an integer value.
+void sound_voice_set_volume(sound_voice_t voice, uint32_t vol);
+
+// Return true if the voice is still playing, otherwise return false.
+// voice: handle returned by sound_play().
+bool sound_voice_busy(sound_voice_t voice);
+
+// Return the most CPU cycles spent mixing one DMA block since sound_init().
+uint32_t sound_mix_cycles(void);
+
+// Set the chain of effects applied to the mixed output, in order, in
+// the audio ISR. Effects run on 16-bit samples before they are reduced to
+// 8 bits for the DAC (I2S output keeps all 16). The echo keeps the output
+// running after the voices end until it has died away.
+// chain: the effects, copied.
+// n: number of effects, up to SOUND_FX_MAX, or zero to remove the chain.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_fx_set(const sound_fx_t *chain, uint32_t n);
+
+// Copy the cost of an effect of the chain.
+// i: index of the effect in the chain.
+// st: where to put the cost.
+// Return zero if successful, or non-zero if there is no such effect.
+int32_t sound_fx_get_stats(uint32_t i, sound_fx_stats_t *st);
+
+// Copy the refill counters.
+// st: where to put the counters.
+void sound_get_stats(sound_stats_t *st);
+
+// Clear the refill counters and events.
+void sound_reset_stats(void);
+
+// Copy the most recent refill events, oldest first.
+// ev: where to put the events.
+// n: the most events to copy, up to SOUND_EVENTS.
+// Return the number of events copied.
+uint32_t sound_get_events(sound_event_t *ev, uint32_t n);
+
+// Log the refill counters and the most recent refill events. The event
+// times can be compared with esp_timer_get_time() taken around LCD flushes
+// or network traffic to find what held off the audio ISR.
+void sound_dump_events(void);
+
+// Count a block padded with silence because a source ran dry. Called from
+// a source function (sound_fill_t) in the audio ISR.
+void sound_underrun(void);
+
+// Open an audio stream and play it on a voice. Samples are copied ahead of
+// the audio ISR into a RAM ring by a low priority prefetch task, so the
+// audio does not have to fit in the app image. Only one stream is open
+// at a time, opening another closes the first.
+// src: a file path starting with '/' (e.g. "/spiffs/song.u8") holding raw
+// unsigned audio, or the label of a data partition (e.g. "storage") holding
+// the byte count as a 32-bit little endian word followed by the audio.
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play cyclically until closed, otherwise play once.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if not successful.
+sound_voice_t sound_stream_open(const char *src, uint32_t vol, bool loop, uint8_t prio);
+
+// Stop the stream and free its resources.
+void sound_stream_close(void);
+
+// Return the number of DMA blocks padded with silence because the
+// prefetch task fell behind, since the stream was opened.
+uint32_t sound_stream_underruns(void);
+
+// Map a blob of audio assets made by audio/audio2pack.py from a data
+// partition. Clips play straight from flash, nothing is copied to RAM.
+// Opening another blob closes the first.
+// label: label of the data partition (e.g. "sounds").
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_asset_open(const char *label);
+
+// Unmap the asset blob. Stop any voice playing an asset first.
+void sound_asset_close(void);
+
+// Find an asset by name in the open blob.
+// name: file name of the clip without its extension, up to 15 characters.
+// Return the asset, or NULL if not found.
+const sound_asset_t *sound_asset_find(const char *name);
+
+// Return a pointer to the unsigned 8-bit samples of an asset.
+// asset: asset returned by sound_asset_find().
+const void *sound_asset_audio(const sound_asset_t *asset);
+
+// Play an asset on a free voice, stealing one like sound_play() if needed.
+// asset: asset returned by sound_asset_find().
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play until stopped, repeating the loop points of the
+// asset if it has them, otherwise the whole clip.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if not successful.
+sound_voice_t sound_asset_play(const sound_asset_t *asset, uint32_t vol, bool loop, uint8_t prio);
+
+// Set the master volume.
 // volume: 0-100% as an integer value.
 void sound_set_volume(uint32_t vol);
 
-// Enable or disable the sound output device.
+// Enable or disable the sound output device. The I2S amplifier has no
+// enable pin, so it is sent silence while disabled.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable);
 
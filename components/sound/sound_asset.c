@@ -0,0 +1,129 @@
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/storage/partition.html
+
+#include <string.h> // strncmp
+
+#include "esp_log.h"
+#include "esp_partition.h"
+
+#include "sound.h"
+
+#define MAGIC 0x41444E53U // "SNDA" little endian
+#define VERSION 1
+
+// Blob header, followed by the index and then the samples.
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t count; // entries in the index
+	uint32_t size; // of the whole blob in bytes
+	uint32_t reserved;
+} header_t;
+
+static const char *TAG = "sound_asset";
+
+static const uint8_t *blob; // mapped partition
+static esp_partition_mmap_handle_t map_h;
+static const sound_asset_t *index_p;
+static uint32_t count;
+
+
+// Check the header and index of a mapped blob.
+// Return zero if sound, or non-zero otherwise.
+static int32_t sound_asset_check(const uint8_t *p, uint32_t part_size)
+{
+	const header_t *h = (const header_t *)p;
+	const sound_asset_t *a = (const sound_asset_t *)(h+1);
+
+	if (h->magic != MAGIC || h->version != VERSION) return -1;
+	if (h->size > part_size ||
+		sizeof(*h) + h->count * sizeof(*a) > h->size) return -1;
+	for (uint32_t i = 0; i < h->count; i++, a++) {
+		if (a->name[SOUND_ASSET_NAME-1] != '\0') return -1;
+		if (a->offset > h->size || a->size > h->size - a->offset) return -1;
+		if (a->loop_end && (a->loop_end > a->size || a->loop_start >= a->loop_end)) return -1;
+		if (i && strncmp(a[-1].name, a->name, SOUND_ASSET_NAME) >= 0) return -1;
+	}
+	return 0;
+}
+
+// Map a blob of audio assets made by audio/audio2pack.py from a data
+// partition. Clips play straight from flash, nothing is copied to RAM.
+// Opening another blob closes the first.
+// label: label of the data partition (e.g. "sounds").
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_asset_open(const char *label)
+{
+	const esp_partition_t *part;
+	const void *p;
+
+	sound_asset_close();
+	part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+	if (part == NULL) {
+		ESP_LOGE(TAG, "no partition %s", label);
+		return -1;
+	}
+	if (part->size < sizeof(header_t) ||
+		esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &p, &map_h) != ESP_OK) {
+		ESP_LOGE(TAG, "can't map %s", label);
+		return -1;
+	}
+	if (sound_asset_check(p, part->size)) {
+		ESP_LOGE(TAG, "bad asset blob in %s", label);
+		esp_partition_munmap(map_h);
+		return -1;
+	}
+	blob = p;
+	index_p = (const sound_asset_t *)(blob + sizeof(header_t));
+	count = ((const header_t *)blob)->count;
+	return 0;
+}
+
+// Unmap the asset blob. Stop any voice playing an asset first.
+void sound_asset_close(void)
+{
+	if (blob) esp_partition_munmap(map_h);
+	blob = NULL;
+	index_p = NULL;
+	count = 0;
+}
+
+// Find an asset by name in the open blob.
+// name: file name of the clip without its extension, up to 15 characters.
+// Return the asset, or NULL if not found.
+const sound_asset_t *sound_asset_find(const char *name)
+{
+	uint32_t lo = 0, hi = count;
+
+	if (name == NULL) return NULL;
+	while (lo < hi) { // binary search of the sorted index
+		uint32_t mid = (lo + hi) / 2;
+		int32_t c = strncmp(name, index_p[mid].name, SOUND_ASSET_NAME);
+		if (c == 0) return index_p + mid;
+		if (c < 0) hi = mid;
+		else lo = mid + 1;
+	}
+	return NULL;
+}
+
+// Return a pointer to the unsigned 8-bit samples of an asset.
+// asset: asset returned by sound_asset_find().
+const void *sound_asset_audio(const sound_asset_t *asset)
+{
+	return blob + asset->offset;
+}
+
+// Play an asset on a free voice, stealing one like sound_play() if needed.
+// asset: asset returned by sound_asset_find().
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play until stopped, repeating the loop points of the
+// asset if it has them, otherwise the whole clip.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if not successful.
+sound_voice_t sound_asset_play(const sound_asset_t *asset, uint32_t vol, bool loop, uint8_t prio)
+{
+	if (asset == NULL || blob == NULL) return -1;
+	if (loop && asset->loop_end)
+		return sound_play_loop(sound_asset_audio(asset), asset->loop_end,
+			asset->hz, asset->loop_start, vol, prio);
+	return sound_play(sound_asset_audio(asset), asset->size, asset->hz, vol, loop, prio);
+}
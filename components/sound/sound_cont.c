@@ -1,107 +1,676 @@
 // https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/peripherals/dac.html
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32s3/api-reference/peripherals/i2s.html
 
 #include <string.h> // memset
+#include <stdatomic.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_check.h"
+#include "esp_cpu.h" // esp_cpu_get_cycle_count
+#include "esp_timer.h"
+#if defined(HW_TARGET_LTAG)
+#include "driver/i2s_std.h"
+#else
 #include "driver/dac_continuous.h"
 #include "driver/gpio.h"
+#endif
 
 #include "hw.h"
 #include "sound.h"
+#include "adpcm.h"
+#include "sound_fx.h"
+
+#if defined(HW_TARGET_LTAG)
+// The ESP32-S3 has no DAC, sound goes out to an I2S amplifier instead.
+#define SOUND_BCLK HW_I2S_BCLK // Bit clock
+#define SOUND_WS   HW_I2S_WS   // Word select (left/right clock)
+#define SOUND_DOUT HW_I2S_DOUT // Serial data out
 
+#define I2S_DESC_NUM 6 // Number of I2S DMA descriptors
+#define I2S_FRAME_NUM 128 // Frames per descriptor, 16-bit mono so 256 bytes
+#define DESC_NUM I2S_DESC_NUM
+#define BLK_SAMPLES I2S_FRAME_NUM // samples per DMA block
+#else
 #define SOUND_A  HW_SND_A  // Audio output
 #define SOUND_EN HW_SND_EN // Sound enable, active high
 
 #define DAC_DESC_NUM 8 // Number of DAC descriptors
-#define DAC_BUF_SZ 128 // DAC buffer size in bytes
+#define DAC_BUF_SZ 128 // DAC buffer size in bytes, at 48 kHz a block lasts 2.7 ms
 // was able to play audio at 48kHz with buf size of  8 and 8 desc, async.
 // was able to play audio at 48kHz with buf size of 64 and 8 desc, sync w/ vol control.
+#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
+#define DAC_SAMPLE_SZ 2 // DMA buffer bytes per sample
+#else
+#define DAC_SAMPLE_SZ 1
+#endif
+#define DESC_NUM DAC_DESC_NUM
+#define BLK_SAMPLES (DAC_BUF_SZ/DAC_SAMPLE_SZ) // samples per DMA block
+#endif
+
+// DMA sizing limits for sound_set_latency()
+#define DESC_MIN 3 // leaves two blocks of slack for a late refill
+#define DESC_MAX 16
+#define BLK_MIN 32 // bounds the refill rate, 750 Hz at 24 kHz
+#define BLK_MAX 1024 // a descriptor holds up to 4092 bytes
+#define MIX_MAX 128 // samples mixed at a time, a block is mixed in pieces
 
 #define SOUND_VOLUME_DEFAULT 50
 #define SILENCE 0x80U
 #define POLL_DELAY 10
 #define PERCENT 100U
 
+#define VOICE_BITS 3 // bits of a handle that select the voice
+#define VOICE_MASK ((1U<<VOICE_BITS)-1)
+#define GEN_MASK (UINT32_MAX >> (VOICE_BITS+1)) // keep handles positive
+#define Q8_ONE 256U // unity gain in Q8
+#define Q16_ONE 0x10000U // one source sample per output sample in Q16
+#define RATE_MAX 8 // highest source rate as a multiple of the output rate
+#define QMASK (SOUND_QUEUE_LEN-1)
+
+#if SOUND_VOICES > (1<<VOICE_BITS)
+#error "SOUND_VOICES does not fit in VOICE_BITS"
+#endif
+
+#if (SOUND_QUEUE_LEN & QMASK) != 0
+#error "SOUND_QUEUE_LEN must be a power of 2"
+#endif
+
+typedef struct {
+	const uint8_t *base; // unsigned 8-bit samples
+	uint32_t size;
+	uint32_t idx;
+	uint32_t lstart; // where a loop restarts, zero unless sound_play_loop()
+	sound_fill_t fill; // source of samples instead of base, if not NULL
+	void *ctx;
+	bool adpcm; // base holds IMA ADPCM codes, size and idx count samples
+	adpcm_state_t dec; // decoder state at idx
+	uint32_t step; // source samples per output sample, Q16
+	uint32_t frac; // phase between h0 and h1, Q16
+	int32_t h0, h1; // levels of source samples idx-2 and idx-1, if resampled
+	                // (idx is size+1 once h1 holds the last sample)
+	bool primed; // h0 and h1 loaded
+	bool queue; // plays the clip queue, base is NULL between clips
+	TaskHandle_t notify; // task to notify when the clip ends
+	uint32_t gen; // start sequence number, zero if idle
+	uint16_t gain; // Q8
+	uint8_t prio;
+	bool loop;
+} voice_t;
+
+// Clip queue slot, same scheme as the LCD command ring (lcd_cmd.c)
+typedef struct {
+	_Atomic uint32_t seq; // slot is free for position seq, full for seq-1
+	sound_clip_t clip;
+} qslot_t;
+
 static const char *TAG = "sound";
 
 // Critical section protected variables
 static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
-static const uint8_t *abase;
-static volatile uint32_t asize;
-static volatile uint32_t aidx;
-static volatile bool     cyclic;
+static voice_t voices[SOUND_VOICES];
+static uint32_t gen_next; // sequence number of the next voice start
+static sound_voice_t main_voice = -1; // voice of sound_start/cyclic
+static sound_voice_t queue_voice = -1; // voice of the clip queue
 static volatile uint32_t dcnt;
+static sound_stats_t stats;
+static sound_event_t events[SOUND_EVENTS]; // ring of recent refills
+static uint32_t ev_cnt; // events recorded, the next goes at ev_cnt % SOUND_EVENTS
+static int64_t t_refill; // time of the previous callback, zero if none
+static const int16_t *lut_run; // volume table the ISR is mixing with, or NULL
 
 // Other global variables
+#if defined(HW_TARGET_LTAG)
+static i2s_chan_handle_t tx_handle;
+#else
 static dac_continuous_handle_t dac_handle;
+#endif
 static volatile bool device_en;
-static volatile uint32_t volume;
-static volatile uint8_t bias; // to prevent popping at end when vol low.
+static int16_t vol_lut[2][256]; // sample to signed level at master volume
+static const int16_t *volatile vol_cur = vol_lut[0]; // table in use
+static volatile int32_t mgain; // master gain in Q8, for 16-bit samples
+static volatile uint32_t mix_cycles; // max cycles to mix one block
+static uint32_t out_hz; // output sample rate
+static BaseType_t woken; // a task was notified from the ISR
+static uint32_t blk_us; // time to play one DMA block
+static uint32_t desc_num = DESC_NUM; // DMA descriptors in use
+static uint32_t blk_len = BLK_SAMPLES; // samples per DMA block
+static uint32_t lat_ms; // latency asked for, zero for the default sizing
+static bool running; // a DMA channel is open
+static bool padded; // a source padded the block being mixed
+static volatile bool fx_ring; // the effects still have output
 
+// Clip queue, pushed lock-free by tasks, popped by the ISR
+static qslot_t qring[SOUND_QUEUE_LEN];
+static _Atomic uint32_t qhead; // next position to claim (producers)
+static _Atomic uint32_t qtail; // next position to pop
 
-static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
-	const dac_event_data_t *event, void *user_data)
+
+// Add n samples from src, scaled by the master volume table and the voice
+// gain, to a saturating 16-bit accumulator.
+static inline void sound_mix_add(int16_t *dst, const uint8_t *src, uint32_t n,
+	const int16_t *lut, int32_t gain)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		int32_t a = dst[k] + (lut[src[k]] * gain >> 8);
+		dst[k] = (a > INT16_MAX) ? INT16_MAX : (a < INT16_MIN) ? INT16_MIN : a;
+	}
+}
+
+// Add n signed 16-bit samples from src, scaled by the master and voice
+// gains, to a saturating 16-bit accumulator.
+static inline void sound_mix_add16(int16_t *dst, const int16_t *src, uint32_t n,
+	int32_t mg, int32_t gain)
+{
+	for (uint32_t k = 0; k < n; k++) {
+		int32_t a = dst[k] + ((src[k] * mg >> 8) * gain >> 8);
+		dst[k] = (a > INT16_MAX) ? INT16_MAX : (a < INT16_MIN) ? INT16_MIN : a;
+	}
+}
+
+// Store the state of a voice mixed from a copy, unless the voice was
+// stopped or restarted meanwhile.
+// v: the copy.
+// slot: index of the voice.
+// done: true if the voice played to its end.
+static void IRAM_ATTR sound_voice_store(const voice_t *v, uint32_t slot, bool done)
 {
-#if CONFIG_DAC_DMA_AUTO_16BIT_ALIGN
-	uint8_t buf[event->buf_size/2];
-#else
-	uint8_t buf[event->buf_size];
-#endif
-	// size_t load_bytes = 0;
 	portENTER_CRITICAL_ISR(&spinlock);
-	if (aidx < asize) {
-		uint32_t idx = aidx;
-		uint32_t size = (!cyclic && asize < sizeof(buf)) ? asize : sizeof(buf);
-		aidx =  cyclic ? (aidx + size) % asize : aidx + size;
-		portEXIT_CRITICAL_ISR(&spinlock);
-		uint32_t i;
-		for (i = 0; i < size; i++) buf[i] = abase[(idx+i)%asize]*volume/PERCENT + bias;
-		while (i < sizeof(buf)) buf[i++] = SILENCE; // pad to block size with silence
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
-			// error if load_bytes != sizeof(buf)
-	} else if (dcnt) {
-		dcnt--; // add silence to DMA buffer when done
-		portEXIT_CRITICAL_ISR(&spinlock);
-		memset(buf, SILENCE, sizeof(buf));
-		dac_continuous_write_asynchronously(handle,
-			event->buf, event->buf_size,
-			buf, sizeof(buf), NULL /*&load_bytes*/);
+	voice_t *p = voices + slot;
+	if (p->gen == v->gen) {
+		uint16_t gain = p->gain; // may have been set meanwhile
+		*p = *v;
+		p->gain = gain;
+		if (done) p->gen = 0;
+	}
+	portEXIT_CRITICAL_ISR(&spinlock);
+}
+
+// The functions below mix up to len samples of a voice's clip into acc,
+// advancing the voice. They return the number of samples mixed, fewer
+// than len once a clip that doesn't loop has ended.
+
+// Mix 8-bit samples at the output rate, in contiguous segments up to the
+// wrap point, so the inner loop has no modulo or divide.
+static uint32_t IRAM_ATTR sound_mix_pcm(int16_t *acc, uint32_t len, voice_t *v,
+	const int16_t *lut)
+{
+	uint32_t i = 0;
+
+	while (i < len) {
+		uint32_t seg = v->size - v->idx;
+		if (seg > len - i) seg = len - i;
+		sound_mix_add(acc + i, v->base + v->idx, seg, lut, v->gain);
+		i += seg;
+		v->idx += seg;
+		if (v->idx == v->size) {
+			if (!v->loop) break;
+			v->idx = v->lstart;
+		}
+	}
+	return i;
+}
+
+// Decode and mix ADPCM at the output rate.
+static uint32_t IRAM_ATTR sound_mix_adpcm(int16_t *acc, uint32_t len, voice_t *v,
+	int32_t mg)
+{
+	static int16_t pcm[MIX_MAX]; // static, like the scratch of sound_mix()
+	uint32_t i = 0;
+
+	while (i < len) {
+		uint32_t seg = v->size - v->idx;
+		if (seg > len - i) seg = len - i;
+		adpcm_decode(&v->dec, v->base, v->idx, pcm + i, seg);
+		i += seg;
+		v->idx += seg;
+		if (v->idx == v->size) {
+			if (!v->loop) break;
+			v->idx = 0;
+			adpcm_reset(&v->dec);
+		}
+	}
+	sound_mix_add16(acc, pcm, i, mg, v->gain);
+	return i;
+}
+
+// Fetch the next source sample of a resampled voice as a level scaled by
+// the master volume, and advance idx.
+// Return false at the end of a voice that doesn't loop.
+static inline bool sound_fetch(voice_t *v, const int16_t *lut, int32_t mg, int32_t *level)
+{
+	if (v->idx == v->size) {
+		if (!v->loop) return false;
+		v->idx = v->lstart; // zero for ADPCM
+		adpcm_reset(&v->dec);
+	}
+	if (v->adpcm) {
+		int16_t s;
+		adpcm_decode(&v->dec, v->base, v->idx, &s, 1);
+		*level = s * mg >> 8;
 	} else {
+		*level = lut[v->base[v->idx]];
+	}
+	v->idx++;
+	return true;
+}
+
+// Mix a voice whose rate differs from the output rate. Each output sample
+// interpolates linearly between source samples h0 and h1 at the Q16 phase
+// frac, which advances by step. The cost per output sample is one
+// interpolation plus at most RATE_MAX source fetches.
+static uint32_t IRAM_ATTR sound_mix_resample(int16_t *acc, uint32_t len, voice_t *v,
+	const int16_t *lut, int32_t mg)
+{
+	uint32_t i;
+
+	if (!v->primed) {
+		if (!sound_fetch(v, lut, mg, &v->h0)) return 0;
+		if (!sound_fetch(v, lut, mg, &v->h1)) {
+			v->h1 = v->h0;
+			v->idx = v->size + 1;
+		}
+		v->primed = true;
+	}
+	for (i = 0; i < len; i++) {
+		if (v->frac >= Q16_ONE) break; // past the last sample
+		int32_t s = v->h0 + ((v->h1 - v->h0) * (int32_t)(v->frac >> 4) >> 12);
+		int32_t a = acc[i] + (s * v->gain >> 8);
+		acc[i] = (a > INT16_MAX) ? INT16_MAX : (a < INT16_MIN) ? INT16_MIN : a;
+		for (v->frac += v->step; v->frac >= Q16_ONE; v->frac -= Q16_ONE) {
+			if (v->idx > v->size) break; // played the last sample, stay ended
+			v->h0 = v->h1;
+			if (!sound_fetch(v, lut, mg, &v->h1)) { // hold the last sample
+				v->h1 = v->h0;
+				v->idx = v->size + 1;
+			}
+		}
+	}
+	return i;
+}
+
+// Mix the clip of a voice with the path for its format and rate.
+static inline uint32_t sound_mix_clip(int16_t *acc, uint32_t len, voice_t *v,
+	const int16_t *lut, int32_t mg)
+{
+	if (v->step != Q16_ONE) return sound_mix_resample(acc, len, v, lut, mg);
+	if (v->adpcm) return sound_mix_adpcm(acc, len, v, mg);
+	return sound_mix_pcm(acc, len, v, lut);
+}
+
+// Load a clip into a voice, ready to mix from its start.
+static void IRAM_ATTR sound_voice_load(voice_t *v, const sound_clip_t *clip)
+{
+	v->base = clip->audio;
+	v->size = clip->size;
+	v->idx = 0;
+	v->lstart = 0;
+	v->adpcm = clip->adpcm;
+	adpcm_reset(&v->dec);
+	if (clip->hz == 0 || out_hz == 0) v->step = Q16_ONE;
+	else if (clip->hz >= RATE_MAX*out_hz) v->step = RATE_MAX*Q16_ONE;
+	else v->step = ((uint64_t)clip->hz << 16) / out_hz;
+	v->frac = 0;
+	v->primed = false;
+	v->notify = clip->notify;
+}
+
+// Take the next clip off the queue. Call within the critical section.
+// Return false if the queue is empty.
+static bool IRAM_ATTR sound_queue_pop(sound_clip_t *clip)
+{
+	uint32_t pos = atomic_load_explicit(&qtail, memory_order_relaxed);
+	qslot_t *s = qring + (pos & QMASK);
+
+	if (atomic_load_explicit(&s->seq, memory_order_acquire) != pos+1) return false;
+	*clip = s->clip;
+	atomic_store_explicit(&s->seq, pos+SOUND_QUEUE_LEN, memory_order_release);
+	atomic_store_explicit(&qtail, pos+1, memory_order_relaxed);
+	return true;
+}
+
+// Mix the queue voice. When a clip ends part way through the block, the
+// task waiting on it is notified and the next clip starts on the very next
+// sample. The voice ends once the queue is empty.
+static void IRAM_ATTR sound_mix_queue(int16_t *acc, uint32_t len, voice_t *v,
+	uint32_t slot, const int16_t *lut, int32_t mg)
+{
+	uint32_t i = 0;
+	sound_clip_t clip;
+	bool more = true;
+
+	while (i < len) {
+		if (v->base == NULL) { // between clips
+			portENTER_CRITICAL_ISR(&spinlock);
+			more = sound_queue_pop(&clip);
+			portEXIT_CRITICAL_ISR(&spinlock);
+			if (!more) break;
+			sound_voice_load(v, &clip);
+		}
+		uint32_t want = len - i;
+		uint32_t got = sound_mix_clip(acc + i, want, v, lut, mg);
+		i += got;
+		if (got < want) { // clip ended
+			if (v->notify) vTaskNotifyGiveFromISR(v->notify, &woken);
+			v->base = NULL;
+		}
+	}
+	// Only end the voice if nothing was queued since the queue was found
+	// empty, sound_enqueue() checks the voice under the same lock.
+	portENTER_CRITICAL_ISR(&spinlock);
+	voice_t *p = voices + slot;
+	if (p->gen == v->gen) {
+		uint16_t gain = p->gain;
+		*p = *v;
+		p->gain = gain;
+		if (!more && !sound_queue_pop(&clip)) p->gen = 0;
+		else if (!more) sound_voice_load(p, &clip);
+	}
+	portEXIT_CRITICAL_ISR(&spinlock);
+}
+
+// Mix len (up to MIX_MAX) samples of the voices into acc, as signed
+// 16-bit levels after the effects. Voices at the output rate playing 8-bit
+// buffers are advanced in the snapshot and mixed directly, the others are
+// mixed from a copy that is stored back afterwards. A source voice is
+// filled first, and ends when its source comes up short. The cost is
+// bounded by SOUND_VOICES passes over the samples plus the sources.
+// The scratch buffers are static to keep them off the ISR stack, which
+// sources and effects also run on. Only one refill runs at a time.
+static void IRAM_ATTR sound_mix(int16_t *acc, uint32_t len)
+{
+	static uint8_t tmp[MIX_MAX];
+	static voice_t v[SOUND_VOICES];
+	static uint8_t slot[SOUND_VOICES];
+	const int16_t *lut;
+	int32_t mg;
+	uint32_t used = 0;
+
+	// Snapshot the voices, then advance them as if the block was mixed.
+	portENTER_CRITICAL_ISR(&spinlock);
+	lut_run = lut = vol_cur;
+	mg = mgain;
+	for (uint32_t n = 0; n < SOUND_VOICES; n++) {
+		voice_t *p = voices + n;
+		if (!p->gen) continue;
+		slot[used] = n;
+		v[used++] = *p;
+		if (p->fill || p->queue || p->adpcm || p->step != Q16_ONE) continue; // advanced after mixing
+		if (p->loop) {
+			p->idx += len;
+			if (p->idx >= p->size) p->idx = p->lstart + (p->idx - p->lstart) % (p->size - p->lstart);
+		}
+		else if (p->size - p->idx > len) p->idx += len;
+		else p->gen = 0; // done after this block
+	}
+	portEXIT_CRITICAL_ISR(&spinlock);
+
+	memset(acc, 0, len*sizeof(acc[0]));
+	for (uint32_t n = 0; n < used; n++) {
+		voice_t *p = v + n;
+		if (p->fill) {
+			uint32_t got = p->fill(p->ctx, tmp, len);
+			if (got > len) got = len;
+			sound_mix_add(acc, tmp, got, lut, p->gain);
+			if (got < len) { // source done, unless restarted meanwhile
+				portENTER_CRITICAL_ISR(&spinlock);
+				if (voices[slot[n]].gen == p->gen) voices[slot[n]].gen = 0;
+				portEXIT_CRITICAL_ISR(&spinlock);
+			}
+		} else if (p->queue) {
+			sound_mix_queue(acc, len, p, slot[n], lut, mg);
+		} else if (p->adpcm || p->step != Q16_ONE) {
+			bool done = sound_mix_clip(acc, len, p, lut, mg) < len;
+			sound_voice_store(p, slot[n], done);
+		} else {
+			sound_mix_pcm(acc, len, p, lut);
+		}
+	}
+	portENTER_CRITICAL_ISR(&spinlock);
+	lut_run = NULL;
+	portEXIT_CRITICAL_ISR(&spinlock);
+	fx_ring = sound_fx_run(acc, len);
+}
+
+// Count a refill and add it to the event ring.
+// now: time of the refill in microseconds.
+// gap: microseconds since the previous refill, or zero if none.
+// cycles: CPU cycles spent in the refill.
+// nv: number of voices playing.
+static void IRAM_ATTR sound_record(int64_t now, uint32_t gap, uint32_t cycles, uint32_t nv)
+{
+	uint8_t flags = 0;
+
+	if (gap > blk_us + blk_us/2) flags |= SOUND_EV_LATE;
+	if (padded) flags |= SOUND_EV_PADDED;
+	if (!nv) flags |= SOUND_EV_IDLE;
+	portENTER_CRITICAL_ISR(&spinlock);
+	stats.refills++;
+	if (flags & SOUND_EV_LATE) stats.late++;
+	if (flags & SOUND_EV_PADDED) stats.padded++;
+	if (cycles > stats.max_cycles) stats.max_cycles = cycles;
+	if (gap > stats.max_gap_us) stats.max_gap_us = gap;
+	sound_event_t *e = events + ev_cnt++ % SOUND_EVENTS;
+	e->us = now;
+	e->gap_us = gap;
+	e->cycles = cycles;
+	e->voices = nv;
+	e->flags = flags;
+	portEXIT_CRITICAL_ISR(&spinlock);
+}
+
+// State of a DMA refill, kept between sound_refill_begin() and
+// sound_refill_end().
+typedef struct {
+	int64_t now; // time of the refill in microseconds
+	uint32_t t0; // cycle count at the start
+	uint32_t gap; // microseconds since the previous refill
+	uint32_t nv; // voices playing
+	bool active; // mix the block, otherwise write silence
+} refill_t;
+
+// Start a refill: count the voices and decide what the block holds.
+// Once the voices and effects are done, silence is written to each of
+// the DMA buffers and then they are left alone.
+// r: refill state to set.
+// Return true if the block is to be written, false to leave it.
+static bool IRAM_ATTR sound_refill_begin(refill_t *r)
+{
+	r->t0 = esp_cpu_get_cycle_count();
+	r->now = esp_timer_get_time();
+	r->nv = 0;
+	woken = pdFALSE;
+	padded = false;
+	portENTER_CRITICAL_ISR(&spinlock);
+	r->gap = t_refill ? r->now - t_refill : 0;
+	t_refill = r->now;
+	for (uint32_t n = 0; n < SOUND_VOICES; n++) r->nv += (voices[n].gen != 0);
+	r->active = (r->nv != 0) || fx_ring;
+	if (r->active) dcnt = desc_num;
+	else if (dcnt) dcnt--; // add silence to DMA buffers when done
+	else {
 		portEXIT_CRITICAL_ISR(&spinlock);
+		return false;
 	}
-	return false; // no high priority task awoken
+	portEXIT_CRITICAL_ISR(&spinlock);
+	return true;
 }
 
+// Finish a refill, recording its cost.
+// r: refill state from sound_refill_begin().
+// mix: CPU cycles spent mixing the block.
+static void IRAM_ATTR sound_refill_end(const refill_t *r, uint32_t mix)
+{
+	if (mix > mix_cycles) mix_cycles = mix;
+	sound_record(r->now, r->gap, esp_cpu_get_cycle_count() - r->t0, r->nv);
+}
 
-// Initialize the sound driver. Must be called before using sound.
-// May be called again to change sample rate.
-// sample_hz: sample rate in Hz to playback audio.
-// Return zero if successful, or non-zero otherwise.
-int32_t sound_init(uint32_t sample_hz)
+#if defined(HW_TARGET_LTAG)
+// The I2S DMA descriptors form a ring that plays continuously. Each
+// buffer is refilled in place as soon as it has been sent, so it plays
+// again desc_num-1 blocks later. No copy is needed since the mixer
+// produces the 16-bit samples the amplifier takes.
+static bool IRAM_ATTR i2s_sent_callback(i2s_chan_handle_t handle,
+	i2s_event_data_t *event, void *user_ctx)
 {
-	sound_set_volume(SOUND_VOLUME_DEFAULT);
-	
-	/* * * * * * * * * * GPIO25 Pin Config * * * * * * * * * */
-	// if the first time called, configure GPIO25 as output
-	if (dac_handle == NULL) {
-		gpio_config_t io_conf = {}; // zero-initialize the config structure
-		io_conf.intr_type = GPIO_INTR_DISABLE;
-		io_conf.mode = GPIO_MODE_OUTPUT;
-		// bit mask of the pins that you want to set, e.g. GPIO25
-		io_conf.pin_bit_mask = 1ULL<<SOUND_EN;
-		io_conf.pull_down_en = 0;
-		io_conf.pull_up_en = 0;
-		gpio_config(&io_conf);
-		gpio_set_level(SOUND_EN, device_en = true);
+	int16_t *buf = event->dma_buf;
+	uint32_t size = event->size / sizeof(buf[0]);
+	uint32_t t = 0;
+	refill_t r;
+
+	if (!sound_refill_begin(&r)) return false;
+	for (uint32_t i = 0, len; i < size; i += len) {
+		len = (size-i < MIX_MAX) ? size-i : MIX_MAX;
+		if (r.active) {
+			uint32_t t1 = esp_cpu_get_cycle_count();
+			sound_mix(buf+i, len);
+			t += esp_cpu_get_cycle_count() - t1;
+		}
+		if (!r.active || !device_en) memset(buf+i, 0, len*sizeof(buf[0]));
 	}
+	sound_refill_end(&r, t);
+	return woken == pdTRUE; // true if a higher priority task was notified
+}
+#else
+// The block is mixed in pieces and converted to 8 bits in conv, then
+// loaded with one write. The driver only takes the start of a DMA buffer
+// and sets the descriptor length to the bytes loaded, so a block can't be
+// written piece by piece. conv and acc are only used here, so they are
+// static rather than stack arrays.
+static bool IRAM_ATTR dac_convert_callback(dac_continuous_handle_t handle,
+	const dac_event_data_t *event, void *user_data)
+{
+	static uint8_t conv[BLK_MAX];
+	static int16_t acc[MIX_MAX];
+	uint32_t size = event->buf_size / DAC_SAMPLE_SZ;
+	uint32_t t = 0;
+	refill_t r;
 
-	// If sound_init called previously, disable & delete prior channel
-	if (dac_handle != NULL) sound_deinit();
+	if (!sound_refill_begin(&r)) return false;
+	if (size > BLK_MAX) size = BLK_MAX;
+	for (uint32_t i = 0, len; i < size; i += len) {
+		len = (size-i < MIX_MAX) ? size-i : MIX_MAX;
+		if (r.active) {
+			uint32_t t1 = esp_cpu_get_cycle_count();
+			sound_mix(acc, len);
+			for (uint32_t k = 0; k < len; k++) conv[i+k] = (acc[k] >> 8) + SILENCE;
+			t += esp_cpu_get_cycle_count() - t1;
+		} else {
+			memset(conv+i, SILENCE, len);
+		}
+	}
+	dac_continuous_write_asynchronously(handle,
+		event->buf, event->buf_size,
+		conv, size, NULL /*&load_bytes*/);
+		// error if load_bytes != size
+	sound_refill_end(&r, t);
+	return woken == pdTRUE; // true if a higher priority task was notified
+}
+#endif
+
+// Return the voice of a handle if it is still playing, otherwise NULL.
+// Call within the critical section.
+static voice_t *sound_voice(sound_voice_t voice)
+{
+	if (voice < 0) return NULL;
+	voice_t *p = voices + (voice & VOICE_MASK);
+	if ((voice & VOICE_MASK) >= SOUND_VOICES || !p->gen ||
+		(p->gen & GEN_MASK) != (uint32_t)voice >> VOICE_BITS) return NULL;
+	return p;
+}
+
+// Convert a volume 0-100% to a Q8 gain.
+static uint16_t sound_gain(uint32_t vol)
+{
+	if (vol > MAX_VOL) vol = MAX_VOL;
+	return vol * Q8_ONE / PERCENT;
+}
+
+// Size the DMA descriptors for the latency asked of sound_set_latency().
+// The audio buffered is split into blocks of about MIX_MAX samples, with
+// fewer, shorter blocks for a short latency and longer blocks once there
+// are DESC_MAX of them.
+static void sound_size(void)
+{
+	desc_num = DESC_NUM;
+	blk_len = BLK_SAMPLES;
+	if (lat_ms) {
+		uint32_t total = (uint64_t)lat_ms * out_hz / 1000; // samples buffered
+		desc_num = total / MIX_MAX;
+		if (desc_num < DESC_MIN) desc_num = DESC_MIN;
+		else if (desc_num > DESC_MAX) desc_num = DESC_MAX;
+		blk_len = total / desc_num & ~3U; // whole 32-bit words of DMA buffer
+		if (blk_len < BLK_MIN) blk_len = BLK_MIN;
+		else if (blk_len > BLK_MAX) blk_len = BLK_MAX;
+	}
+	blk_us = (uint64_t)blk_len * 1000000 / out_hz;
+}
+
+#if defined(HW_TARGET_LTAG)
+// Open the I2S channel at out_hz, sized by sound_size(), and start it.
+// Return zero if successful, or non-zero otherwise.
+static int32_t sound_open(void)
+{
+	sound_size();
+
+	/* * * * * * * * * * I2S Sound Config * * * * * * * * * */
+	i2s_chan_config_t chan_cfg = I2S_CHANNEL_DEFAULT_CONFIG(I2S_NUM_AUTO, I2S_ROLE_MASTER);
+	chan_cfg.dma_desc_num = desc_num;
+	chan_cfg.dma_frame_num = blk_len;
+	chan_cfg.auto_clear = false; // would clear the buffer refilled in the callback
+	i2s_std_config_t std_cfg = {
+		.clk_cfg = I2S_STD_CLK_DEFAULT_CONFIG(out_hz),
+		// 16-bit mono, the same sample is sent in both slots
+		.slot_cfg = I2S_STD_PHILIPS_SLOT_DEFAULT_CONFIG(I2S_DATA_BIT_WIDTH_16BIT, I2S_SLOT_MODE_MONO),
+		.gpio_cfg = {
+			.mclk = I2S_GPIO_UNUSED,
+			.bclk = SOUND_BCLK,
+			.ws = SOUND_WS,
+			.dout = SOUND_DOUT,
+			.din = I2S_GPIO_UNUSED,
+			.invert_flags = {
+				.mclk_inv = false,
+				.bclk_inv = false,
+				.ws_inv = false,
+			},
+		},
+	};
+
+	// Allocate the TX channel, its DMA buffers start out zeroed (silence)
+	ESP_ERROR_CHECK(i2s_new_channel(&chan_cfg, &tx_handle, NULL));
+	ESP_ERROR_CHECK(i2s_channel_init_std_mode(tx_handle, &std_cfg));
+	i2s_event_callbacks_t cbs = {
+		.on_recv = NULL,
+		.on_recv_q_ovf = NULL,
+		.on_sent = i2s_sent_callback, // provides the DMA buffer just sent
+		.on_send_q_ovf = NULL,
+	};
+	ESP_ERROR_CHECK(i2s_channel_register_event_callback(tx_handle, &cbs, NULL));
+	t_refill = 0; // the gap since the last refill is not late
+	dcnt = desc_num; // write silence over each new buffer
+	ESP_LOGI(TAG, "Start I2S audio DMA");
+	ESP_ERROR_CHECK(i2s_channel_enable(tx_handle));
+	running = true;
+	return 0;
+}
+
+// Stop the I2S channel and delete it.
+static void sound_close(void)
+{
+	ESP_LOGI(TAG, "Stop I2S audio DMA");
+	ESP_ERROR_CHECK(i2s_channel_disable(tx_handle));
+	ESP_ERROR_CHECK(i2s_del_channel(tx_handle));
+	tx_handle = NULL;
+	running = false;
+}
+#else
+// Open the DAC channel at out_hz, sized by sound_size(), and start async
+// writing. Sync writing is never used, see the notes at the end.
+// Return zero if successful, or non-zero otherwise.
+static int32_t sound_open(void)
+{
+	sound_size();
 
 	/* * * * * * * * * * GPIO26 Sound Config * * * * * * * * * */
 	if (SOUND_A != 26) {
@@ -110,9 +679,9 @@ int32_t sound_init(uint32_t sample_hz)
 	}
 	dac_continuous_config_t cont_cfg = {
 		.chan_mask = DAC_CHANNEL_MASK_CH1, // GPIO26 only
-		.desc_num = DAC_DESC_NUM,
-		.buf_size = DAC_BUF_SZ,
-		.freq_hz = sample_hz,
+		.desc_num = desc_num,
+		.buf_size = blk_len*DAC_SAMPLE_SZ,
+		.freq_hz = out_hz,
 		.offset = 0,
 		.clk_src = DAC_DIGI_CLK_SRC_DEFAULT,
 		// .clk_src = DAC_DIGI_CLK_SRC_APLL, // APLL source caused noise
@@ -135,16 +704,18 @@ int32_t sound_init(uint32_t sample_hz)
 	};
 	// Register the callback for asynchronous writing
 	ESP_ERROR_CHECK(dac_continuous_register_event_callback(dac_handle, &cbs, NULL));
+	t_refill = 0; // the gap since the last refill is not late
+	dcnt = desc_num; // write silence over each new buffer
 	// Enable the continuous channels
 	ESP_ERROR_CHECK(dac_continuous_enable(dac_handle));
 	ESP_LOGI(TAG, "Start async audio DMA");
 	ESP_ERROR_CHECK(dac_continuous_start_async_writing(dac_handle));
+	running = true;
 	return 0;
 }
 
-// Free resources used for sound (DAC, etc.).
-// Return zero if successful, or non-zero otherwise.
-int32_t sound_deinit(void)
+// Stop async writing and delete the DAC channel.
+static void sound_close(void)
 {
 	ESP_LOGI(TAG, "Stop async audio DMA");
 	ESP_ERROR_CHECK(dac_continuous_stop_async_writing(dac_handle));
@@ -153,72 +724,442 @@ int32_t sound_deinit(void)
 	ESP_ERROR_CHECK(dac_continuous_register_event_callback(dac_handle, &cbs, NULL));
 	ESP_ERROR_CHECK(dac_continuous_del_channels(dac_handle));
 	dac_handle = NULL;
+	running = false;
+}
+#endif
+
+// Initialize the sound driver. Must be called before using sound.
+// May be called again to change sample rate. The mixer drives the DAC on
+// GPIO26 with 8-bit samples, or with HW_TARGET_LTAG (ESP32-S3, no DAC) an
+// I2S amplifier with 16-bit samples.
+// sample_hz: sample rate in Hz to playback audio.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_init(uint32_t sample_hz)
+{
+	sound_set_volume(SOUND_VOLUME_DEFAULT);
+	mix_cycles = 0;
+	out_hz = sample_hz;
+	sound_fx_rate(sample_hz);
+	sound_reset_stats();
+	if (!running) { // first call, the queue is empty
+		for (uint32_t i = 0; i < SOUND_QUEUE_LEN; i++) atomic_init(&qring[i].seq, i);
+		atomic_init(&qhead, 0);
+		atomic_init(&qtail, 0);
+#if defined(HW_TARGET_LTAG)
+		device_en = true; // the amplifier has no enable pin
+#else
+		/* * * * * * * * * * GPIO25 Pin Config * * * * * * * * * */
+		// if the first time called, configure GPIO25 as output
+		gpio_config_t io_conf = {}; // zero-initialize the config structure
+		io_conf.intr_type = GPIO_INTR_DISABLE;
+		io_conf.mode = GPIO_MODE_OUTPUT;
+		// bit mask of the pins that you want to set, e.g. GPIO25
+		io_conf.pin_bit_mask = 1ULL<<SOUND_EN;
+		io_conf.pull_down_en = 0;
+		io_conf.pull_up_en = 0;
+		gpio_config(&io_conf);
+		gpio_set_level(SOUND_EN, device_en = true);
+#endif
+	}
+
+	// If sound_init called previously, disable & delete prior channel
+	if (running) sound_close();
+	return sound_open();
+}
+
+// Free resources used for sound (DAC, etc.).
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_deinit(void)
+{
+	if (running) sound_close();
 	return 0;
 }
 
-// Start playing the sound immediately. Play the audio buffer once.
+// Set the output latency: the longest time from starting a voice to its
+// first sample leaving the DAC (or I2S), which is the audio held in the
+// DMA buffers. The descriptor count and size are recomputed for the
+// sample rate and the channel is rebuilt, staying in async mode, while
+// the voices carry on. A short latency suits sound effects that follow
+// input, a long one fewer refills and more slack for a late refill.
+// ms: latency in milliseconds, or zero for the default sizing. Kept by
+// sound_init().
+// Return the latency achieved in microseconds, or zero before sound_init().
+uint32_t sound_set_latency(uint32_t ms)
+{
+	lat_ms = ms;
+	if (!running) return 0;
+	sound_close();
+	if (sound_open()) return 0;
+	return sound_get_latency();
+}
+
+// Return the output latency in microseconds (see sound_set_latency()),
+// or zero before sound_init().
+uint32_t sound_get_latency(void)
+{
+	if (!running) return 0;
+	return (uint64_t)desc_num * blk_len * 1000000 / out_hz;
+}
+
+// Start a voice. Call within the critical section.
+// clip: the clip to play, NULL for a source or the queue.
+// fill: source function, or NULL.
+// queue: if true, play the clip queue.
+static sound_voice_t sound_voice_start(const sound_clip_t *clip, sound_fill_t fill,
+	void *ctx, bool queue, uint32_t vol, bool loop, uint8_t prio)
+{
+	static const sound_clip_t none = {0};
+	voice_t *p = NULL;
+
+	if (clip == NULL) clip = &none;
+	else if (clip->audio == NULL || clip->size == 0) return -1;
+	for (uint32_t n = 0; n < SOUND_VOICES && p == NULL; n++)
+		if (!voices[n].gen) p = voices + n;
+	if (p == NULL) { // steal the lowest priority, oldest voice
+		for (uint32_t n = 0; n < SOUND_VOICES; n++) {
+			voice_t *q = voices + n;
+			if (q->prio > prio) continue;
+			if (p == NULL || q->prio < p->prio ||
+				(q->prio == p->prio && (int32_t)(q->gen - p->gen) < 0)) p = q;
+		}
+		if (p == NULL) return -1;
+	}
+	if (++gen_next == 0) gen_next = 1; // zero marks an idle voice
+	sound_voice_load(p, clip);
+	p->fill = fill;
+	p->ctx = ctx;
+	p->queue = queue;
+	p->gen = gen_next;
+	p->gain = sound_gain(vol);
+	p->prio = prio;
+	p->loop = loop;
+	return (sound_voice_t)((p->gen & GEN_MASK) << VOICE_BITS | (p - voices));
+}
+
+// Start playing the sound immediately on the main voice, replacing the
+// last buffer given to sound_start() or sound_cyclic(). Play it once.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 // wait: if true, block until done playing, otherwise return straight away.
 void sound_start(const void *audio, uint32_t size, bool wait)
 {
+	sound_voice_t v;
+
 	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = false;
-	dcnt = DAC_DESC_NUM;
+	voice_t *p = sound_voice(main_voice);
+	if (p) p->gen = 0;
+	main_voice = v = sound_voice_start(&(sound_clip_t){.audio = audio, .size = size},
+		NULL, NULL, false, MAX_VOL, false, UINT8_MAX);
 	portEXIT_CRITICAL(&spinlock);
-	while (wait && aidx < asize)
+	while (wait && sound_voice_busy(v))
 		vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
 }
 
-// Cyclically play samples from audio buffer until sound_stop() is called.
+// Cyclically play samples from audio buffer on the main voice until
+// sound_stop() is called.
 // audio: a pointer to an array of unsigned audio data.
 // size: the size of the array in bytes.
 void sound_cyclic(const void *audio, uint32_t size)
 {
 	portENTER_CRITICAL(&spinlock);
-	abase = audio;
-	asize = size;
-	aidx = 0;
-	cyclic = true;
-	dcnt = DAC_DESC_NUM;
+	voice_t *p = sound_voice(main_voice);
+	if (p) p->gen = 0;
+	main_voice = sound_voice_start(&(sound_clip_t){.audio = audio, .size = size},
+		NULL, NULL, false, MAX_VOL, true, UINT8_MAX);
 	portEXIT_CRITICAL(&spinlock);
 }
 
-// Return true if sound playing, otherwise return false.
+// Return true if sound playing (on any voice), otherwise return false.
 bool sound_busy(void)
 {
-	return aidx < asize;
+	bool busy = false;
+
+	for (uint32_t n = 0; n < SOUND_VOICES; n++) busy |= (voices[n].gen != 0);
+	return busy;
 }
 
-// Stop playing the sound.
+// Stop playing the sound (all voices) and empty the clip queue.
 void sound_stop(void)
 {
+	sound_clip_t clip;
+
+	portENTER_CRITICAL(&spinlock);
+	for (uint32_t n = 0; n < SOUND_VOICES; n++) voices[n].gen = 0;
+	while (sound_queue_pop(&clip)); // drop queued clips
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Play the audio buffer on a free voice. If all voices are busy, the voice
+// with the lowest priority not above prio is stolen, the oldest one first.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes.
+// hz: sample rate of the audio in Hz, or 0 for the output rate. Other
+// rates, up to 8 times the output rate, are resampled linearly.
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play cyclically until stopped, otherwise play once.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play(const void *audio, uint32_t size, uint32_t hz, uint32_t vol, bool loop, uint8_t prio)
+{
+	sound_voice_t v;
+
 	portENTER_CRITICAL(&spinlock);
-	aidx = asize;
+	v = sound_voice_start(&(sound_clip_t){.audio = audio, .size = size, .hz = hz},
+		NULL, NULL, false, vol, loop, prio);
 	portEXIT_CRITICAL(&spinlock);
+	return v;
 }
 
-// Set the volume.
+// Play the audio buffer on a free voice like sound_play(), once from
+// the start, then cyclically from loop_start until stopped.
+// audio: a pointer to an array of unsigned audio data.
+// size: the size of the array in bytes, the end of the loop.
+// hz: sample rate of the audio in Hz, or 0 for the output rate.
+// loop_start: index of the sample where the loop starts.
+// vol: voice volume 0-100% as an integer value.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play_loop(const void *audio, uint32_t size, uint32_t hz, uint32_t loop_start, uint32_t vol, uint8_t prio)
+{
+	sound_voice_t v;
+
+	if (loop_start >= size) return -1;
+	portENTER_CRITICAL(&spinlock);
+	v = sound_voice_start(&(sound_clip_t){.audio = audio, .size = size, .hz = hz},
+		NULL, NULL, false, vol, true, prio);
+	voice_t *p = sound_voice(v);
+	if (p) p->lstart = loop_start;
+	portEXIT_CRITICAL(&spinlock);
+	return v;
+}
+
+// Play an IMA ADPCM clip, made by audio/audio2adpcm.m, on a free voice,
+// stealing one like sound_play() if needed. The clip is decoded block by
+// block in the audio ISR.
+// adpcm: a pointer to the clip's 4-bit codes.
+// samples: the number of samples (twice the size of the array in bytes).
+// hz: sample rate of the audio in Hz, or 0 for the output rate. Other
+// rates, up to 8 times the output rate, are resampled linearly.
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play cyclically until stopped, otherwise play once.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play_adpcm(const void *adpcm, uint32_t samples, uint32_t hz, uint32_t vol, bool loop, uint8_t prio)
+{
+	sound_voice_t v;
+
+	portENTER_CRITICAL(&spinlock);
+	v = sound_voice_start(&(sound_clip_t){.audio = adpcm, .size = samples, .hz = hz, .adpcm = true},
+		NULL, NULL, false, vol, loop, prio);
+	portEXIT_CRITICAL(&spinlock);
+	return v;
+}
+
+// Play samples produced by a source function on a free voice, stealing one
+// like sound_play() if needed. The voice ends when the source returns fewer
+// samples than asked for, or when stopped.
+// fill: source function, called from the audio ISR once per DMA block.
+// ctx: context passed to fill.
+// vol: voice volume 0-100% as an integer value.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if no voice could be stolen.
+sound_voice_t sound_play_source(sound_fill_t fill, void *ctx, uint32_t vol, uint8_t prio)
+{
+	sound_voice_t v;
+
+	if (fill == NULL) return -1;
+	portENTER_CRITICAL(&spinlock);
+	v = sound_voice_start(NULL, fill, ctx, false, vol, false, prio);
+	portEXIT_CRITICAL(&spinlock);
+	return v;
+}
+
+// Queue a clip to play after the clips queued before it, with no gap: the
+// next clip starts on the sample after the previous one ends, even in the
+// middle of a DMA block. The queue plays on its own voice at the highest
+// priority, started as needed. Safe to call from several tasks.
+// clip: the clip, copied into the queue.
+// Return true if queued, or false if the queue is full.
+bool sound_enqueue(const sound_clip_t *clip)
+{
+	uint32_t pos = atomic_load_explicit(&qhead, memory_order_relaxed);
+	qslot_t *s;
+
+	if (clip == NULL || clip->audio == NULL || clip->size == 0) return false;
+	for (;;) {
+		s = qring + (pos & QMASK);
+		uint32_t seq = atomic_load_explicit(&s->seq, memory_order_acquire);
+		int32_t dif = (int32_t)(seq - pos);
+		if (dif == 0) { // slot free, try to claim it
+			if (atomic_compare_exchange_weak_explicit(&qhead, &pos, pos+1,
+				memory_order_relaxed, memory_order_relaxed)) break;
+		} else if (dif < 0) { // queue full
+			return false;
+		} else { // another producer claimed it first
+			pos = atomic_load_explicit(&qhead, memory_order_relaxed);
+		}
+	}
+	s->clip = *clip;
+	atomic_store_explicit(&s->seq, pos+1, memory_order_release);
+
+	// The ISR only ends the queue voice after finding the queue empty under
+	// this lock, so the clip can't be left behind.
+	portENTER_CRITICAL(&spinlock);
+	if (sound_voice(queue_voice) == NULL)
+		queue_voice = sound_voice_start(NULL, NULL, NULL, true, MAX_VOL, false, UINT8_MAX);
+	portEXIT_CRITICAL(&spinlock);
+	return true;
+}
+
+// Return the handle of the voice playing the clip queue, for example to
+// set its volume. The handle is stale once the queue runs empty.
+sound_voice_t sound_queue_voice(void)
+{
+	return queue_voice;
+}
+
+// Stop a voice. Stale handles are ignored.
+// voice: handle returned by sound_play().
+void sound_voice_stop(sound_voice_t voice)
+{
+	portENTER_CRITICAL(&spinlock);
+	voice_t *p = sound_voice(voice);
+	if (p) p->gen = 0;
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Set the volume of a voice. Stale handles are ignored.
+// voice: handle returned by sound_play().
+// vol: 0-100% as an integer value.
+void sound_voice_set_volume(sound_voice_t voice, uint32_t vol)
+{
+	portENTER_CRITICAL(&spinlock);
+	voice_t *p = sound_voice(voice);
+	if (p) p->gain = sound_gain(vol);
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Return true if the voice is still playing, otherwise return false.
+// voice: handle returned by sound_play().
+bool sound_voice_busy(sound_voice_t voice)
+{
+	portENTER_CRITICAL(&spinlock);
+	bool busy = sound_voice(voice) != NULL;
+	portEXIT_CRITICAL(&spinlock);
+	return busy;
+}
+
+// Return the most CPU cycles spent mixing one DMA block since sound_init().
+uint32_t sound_mix_cycles(void)
+{
+	return mix_cycles;
+}
+
+// Copy the refill counters.
+// st: where to put the counters.
+void sound_get_stats(sound_stats_t *st)
+{
+	portENTER_CRITICAL(&spinlock);
+	*st = stats;
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Clear the refill counters and events.
+void sound_reset_stats(void)
+{
+	portENTER_CRITICAL(&spinlock);
+	memset(&stats, 0, sizeof(stats));
+	ev_cnt = 0;
+	t_refill = 0;
+	portEXIT_CRITICAL(&spinlock);
+}
+
+// Copy the most recent refill events, oldest first.
+// ev: where to put the events.
+// n: the most events to copy, up to SOUND_EVENTS.
+// Return the number of events copied.
+uint32_t sound_get_events(sound_event_t *ev, uint32_t n)
+{
+	portENTER_CRITICAL(&spinlock);
+	if (n > SOUND_EVENTS) n = SOUND_EVENTS;
+	if (n > ev_cnt) n = ev_cnt;
+	for (uint32_t i = 0, j = ev_cnt - n; i < n; i++, j++) ev[i] = events[j % SOUND_EVENTS];
+	portEXIT_CRITICAL(&spinlock);
+	return n;
+}
+
+// Log the refill counters and the most recent refill events. The event
+// times can be compared with esp_timer_get_time() taken around LCD flushes
+// or network traffic to find what held off the audio ISR.
+void sound_dump_events(void)
+{
+	sound_stats_t st;
+	sound_event_t ev[SOUND_EVENTS];
+
+	sound_get_stats(&st);
+	uint32_t n = sound_get_events(ev, SOUND_EVENTS);
+	ESP_LOGI(TAG, "refills %lu late %lu padded %lu max %lu cycles, gap %lu us (block %lu us)",
+		(unsigned long)st.refills, (unsigned long)st.late, (unsigned long)st.padded,
+		(unsigned long)st.max_cycles, (unsigned long)st.max_gap_us, (unsigned long)blk_us);
+	for (uint32_t i = 0; i < n; i++) {
+		ESP_LOGI(TAG, "%10lu us +%5lu %6lu cyc %u voices%s%s%s",
+			(unsigned long)ev[i].us, (unsigned long)ev[i].gap_us, (unsigned long)ev[i].cycles,
+			ev[i].voices,
+			(ev[i].flags & SOUND_EV_LATE) ? " late" : "",
+			(ev[i].flags & SOUND_EV_PADDED) ? " padded" : "",
+			(ev[i].flags & SOUND_EV_IDLE) ? " idle" : "");
+	}
+}
+
+// Count a block padded with silence because a source ran dry. Called from
+// a source function (sound_fill_t) in the audio ISR.
+void IRAM_ATTR sound_underrun(void)
+{
+	padded = true;
+}
+
+// Set the master volume.
 // volume: 0-100% as an integer value.
 void sound_set_volume(uint32_t vol)
 {
-	volume = vol;
-	bias = SILENCE - (SILENCE * vol / PERCENT);
+	int32_t g = sound_gain(vol);
+	int16_t *lut;
+
+	// Wait for the ISR to finish with the idle table, it can't start
+	// mixing with it again while it isn't the one in use. Then fill it and
+	// switch, so the ISR never mixes with a table half done.
+	for (;;) {
+		portENTER_CRITICAL(&spinlock);
+		lut = vol_lut[vol_cur == vol_lut[0]];
+		bool busy = (lut_run == lut);
+		portEXIT_CRITICAL(&spinlock);
+		if (!busy) break;
+		vTaskDelay(1);
+	}
+	for (int32_t s = 0; s < 256; s++) lut[s] = (s - (int32_t)SILENCE) * g;
+	portENTER_CRITICAL(&spinlock);
+	vol_cur = lut;
+	mgain = g;
+	portEXIT_CRITICAL(&spinlock);
 }
 
-// Enable or disable the sound output device.
+// Enable or disable the sound output device. The I2S amplifier has no
+// enable pin, so it is sent silence while disabled.
 // enable: if true, enable sound, otherwise disable.
 void sound_device(bool enable)
 {
+#if defined(HW_TARGET_LTAG)
+	device_en = enable; // the I2S refill writes silence while disabled
+#else
 	gpio_set_level(SOUND_EN, device_en = enable);
+#endif
 }
 
 // NOTES:
 // * Switching back and forth between sync and async crashes with WDT timeout
-// in ISR. The crash happens when async follows sync.
+// in ISR. The crash happens when async follows sync. sound_set_latency()
+// avoids it by deleting the channel and starting a new one in async mode,
+// never switching the mode of a channel.
 // * Calling dac_continuous_start_async_writing() starts sending data out the
 // DAC from the DMA buffers. Source code shows this function also clears the
 // DMA buffers (to zero) before starting the DMA so you don't have lots of
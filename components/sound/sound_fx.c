@@ -0,0 +1,289 @@
+// https://www.w3.org/TR/audio-eq-cookbook/
+
+#include <stdlib.h> // malloc
+#include <string.h> // memset
+#include <math.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_cpu.h" // esp_cpu_get_cycle_count
+
+#include "sound.h"
+#include "sound_fx.h"
+
+#define Q14 14 // biquad coefficient fraction bits
+#define Q14_ONE (1 << Q14)
+#define CURVE_BITS 8 // limiter curve entries, log2
+#define CURVE_SHIFT (15 - CURVE_BITS) // sample bits between curve entries
+#define CURVE_N (1 << CURVE_BITS)
+#define ECHO_MASK (SOUND_FX_ECHO_LEN-1)
+#define RING_MIN 128 // echo level still heard on the 8-bit DAC
+#define PERCENT 100U
+#define MS_PER_S 1000U
+#define FULL_SCALE INT16_MAX
+
+#if (SOUND_FX_ECHO_LEN & ECHO_MASK) != 0
+#error "SOUND_FX_ECHO_LEN must be a power of 2"
+#endif
+
+typedef struct {
+	sound_fx_type_t type;
+	uint32_t budget;
+	sound_fx_stats_t stats;
+	int32_t b0, b1, b2, a1, a2; // biquad, Q14
+	int32_t x1, x2, y1, y2; // biquad history
+	uint32_t delay; // echo, samples
+	int32_t fb, mix; // echo, Q8
+} stage_t;
+
+typedef struct {
+	stage_t stage[SOUND_FX_MAX];
+	uint32_t n;
+	int16_t curve[CURVE_N+1]; // limiter output for |x| at each 2^CURVE_SHIFT
+} chain_t;
+
+static const char *TAG = "sound_fx";
+
+// Critical section protected variables
+static portMUX_TYPE spinlock = portMUX_INITIALIZER_UNLOCKED;
+static chain_t *fx_cur; // chain in use, or NULL
+static chain_t *fx_run; // chain the ISR is running, or NULL
+
+// Other global variables
+static chain_t chains[2]; // the one in use, and one to set up the next
+static int16_t *line; // echo delay line, allocated on first use
+static uint32_t line_pos; // ISR only
+static uint32_t fx_hz = 1;
+
+
+static inline int32_t IRAM_ATTR sat16(int32_t a)
+{
+	return (a > INT16_MAX) ? INT16_MAX : (a < INT16_MIN) ? INT16_MIN : a;
+}
+
+// 2-pole low-pass filter, direct form I.
+static void IRAM_ATTR fx_lpf(stage_t *f, int16_t *acc, uint32_t len)
+{
+	int32_t x1 = f->x1, x2 = f->x2, y1 = f->y1, y2 = f->y2;
+
+	for (uint32_t i = 0; i < len; i++) {
+		int32_t x = acc[i];
+		int64_t a = (int64_t)f->b0*x + (int64_t)f->b1*x1 + (int64_t)f->b2*x2
+			- (int64_t)f->a1*y1 - (int64_t)f->a2*y2;
+		int32_t y = sat16(a >> Q14);
+		x2 = x1; x1 = x;
+		y2 = y1; y1 = y;
+		acc[i] = y;
+	}
+	f->x1 = x1; f->x2 = x2; f->y1 = y1; f->y2 = y2;
+}
+
+// Echo from a delay line with feedback.
+// Return true if the line still holds audible echo.
+static bool IRAM_ATTR fx_echo(stage_t *f, int16_t *acc, uint32_t len)
+{
+	uint32_t p = line_pos;
+	int32_t peak = 0;
+
+	for (uint32_t i = 0; i < len; i++, p = (p+1) & ECHO_MASK) {
+		int32_t x = acc[i];
+		int32_t d = line[(p - f->delay) & ECHO_MASK];
+		line[p] = sat16(x + (d * f->fb >> 8));
+		acc[i] = sat16(x + (d * f->mix >> 8));
+		peak |= (d < 0) ? -d : d;
+	}
+	line_pos = p;
+	return peak >= RING_MIN;
+}
+
+// Soft limiter, interpolated from the curve.
+static void IRAM_ATTR fx_limit(const int16_t *curve, int16_t *acc, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++) {
+		int32_t x = acc[i];
+		int32_t u = (x < 0) ? -x : x;
+		if (u > FULL_SCALE) u = FULL_SCALE;
+		int32_t k = u >> CURVE_SHIFT, r = u & ((1 << CURVE_SHIFT) - 1);
+		int32_t y = curve[k] + ((curve[k+1] - curve[k]) * r >> CURVE_SHIFT);
+		acc[i] = (x < 0) ? -y : y;
+	}
+}
+
+// Run the chain over a mixed block. Safe to call from an IRAM ISR.
+// acc: signed 16-bit samples, processed in place.
+// len: number of samples.
+// Return true while an effect still has output after its input ends.
+bool IRAM_ATTR sound_fx_run(int16_t *acc, uint32_t len)
+{
+	chain_t *c;
+	bool ring = false;
+
+	portENTER_CRITICAL_ISR(&spinlock);
+	fx_run = c = fx_cur;
+	portEXIT_CRITICAL_ISR(&spinlock);
+	if (c == NULL) return false;
+
+	for (uint32_t i = 0; i < c->n; i++) {
+		stage_t *f = c->stage + i;
+		uint32_t t0 = esp_cpu_get_cycle_count();
+		switch (f->type) {
+		case SOUND_FX_LPF: fx_lpf(f, acc, len); break;
+		case SOUND_FX_ECHO: ring |= fx_echo(f, acc, len); break;
+		case SOUND_FX_LIMIT: fx_limit(c->curve, acc, len); break;
+		}
+		uint32_t t = esp_cpu_get_cycle_count() - t0;
+		if (t > f->stats.max_cycles) f->stats.max_cycles = t;
+		if (f->budget && t > f->budget) f->stats.over++;
+	}
+
+	portENTER_CRITICAL_ISR(&spinlock);
+	fx_run = NULL;
+	portEXIT_CRITICAL_ISR(&spinlock);
+	return ring;
+}
+
+// Set the output sample rate that effects are tuned for. Call before
+// setting a chain.
+// hz: sample rate in Hz.
+void sound_fx_rate(uint32_t hz)
+{
+	if (hz) fx_hz = hz;
+}
+
+// Work out the biquad coefficients of a low-pass filter.
+static int32_t fx_lpf_init(stage_t *f, const sound_fx_t *fx)
+{
+	if (fx->lpf.cutoff_hz == 0 || fx->lpf.cutoff_hz >= fx_hz/2 || fx->lpf.q100 == 0) {
+		ESP_LOGE(TAG, "bad low-pass %lu Hz", (unsigned long)fx->lpf.cutoff_hz);
+		return -1;
+	}
+	float w0 = 2.0f * (float)M_PI * fx->lpf.cutoff_hz / fx_hz;
+	float alpha = sinf(w0) * PERCENT / (2.0f * fx->lpf.q100);
+	float cw = cosf(w0), a0 = 1.0f + alpha;
+	f->b0 = lrintf((1.0f - cw) / 2.0f / a0 * Q14_ONE);
+	f->b1 = lrintf((1.0f - cw) / a0 * Q14_ONE);
+	f->b2 = f->b0;
+	f->a1 = lrintf(-2.0f * cw / a0 * Q14_ONE);
+	f->a2 = lrintf((1.0f - alpha) / a0 * Q14_ONE);
+	return 0;
+}
+
+// Set up the delay line of an echo.
+static int32_t fx_echo_init(stage_t *f, const sound_fx_t *fx)
+{
+	f->delay = (uint64_t)fx->echo.delay_ms * fx_hz / MS_PER_S;
+	if (f->delay == 0 || f->delay >= SOUND_FX_ECHO_LEN ||
+		fx->echo.feedback >= PERCENT || fx->echo.mix > PERCENT) {
+		ESP_LOGE(TAG, "bad echo %lu ms", (unsigned long)fx->echo.delay_ms);
+		return -1;
+	}
+	if (line == NULL) {
+		line = malloc(SOUND_FX_ECHO_LEN * sizeof(line[0]));
+		if (line == NULL) {
+			ESP_LOGE(TAG, "no memory for echo");
+			return -1;
+		}
+	}
+	f->fb = fx->echo.feedback * 256 / PERCENT;
+	f->mix = fx->echo.mix * 256 / PERCENT;
+	return 0;
+}
+
+// Work out the limiter curve: straight up to the threshold, then bending
+// over towards full scale.
+static int32_t fx_limit_init(chain_t *c, const sound_fx_t *fx)
+{
+	if (fx->limit.threshold > PERCENT) {
+		ESP_LOGE(TAG, "bad limiter threshold %u", fx->limit.threshold);
+		return -1;
+	}
+	float t = (float)fx->limit.threshold / PERCENT, knee = 1.0f - t;
+	for (uint32_t k = 0; k <= CURVE_N; k++) {
+		float u = (float)k / CURVE_N;
+		float y = (u <= t) ? u : t + knee * tanhf((u - t) / knee);
+		c->curve[k] = lrintf(y * FULL_SCALE);
+	}
+	return 0;
+}
+
+// Set the chain of effects applied to the mixed output, in order, in
+// the audio ISR. Effects run on 16-bit samples before they are reduced to
+// 8 bits for the DAC (I2S output keeps all 16). The echo keeps the output
+// running after the voices end until it has died away.
+// chain: the effects, copied.
+// n: number of effects, up to SOUND_FX_MAX, or zero to remove the chain.
+// Return zero if successful, or non-zero otherwise.
+int32_t sound_fx_set(const sound_fx_t *chain, uint32_t n)
+{
+	chain_t *c;
+	bool echo = false, limit = false;
+
+	if (n > SOUND_FX_MAX || (n && chain == NULL)) return -1;
+	if (n == 0) {
+		portENTER_CRITICAL(&spinlock);
+		fx_cur = NULL;
+		portEXIT_CRITICAL(&spinlock);
+		return 0;
+	}
+
+	// Wait for the ISR to finish with the spare chain, it can't start
+	// running it again while it isn't the one in use.
+	for (;;) {
+		portENTER_CRITICAL(&spinlock);
+		c = (fx_cur == chains) ? chains+1 : chains;
+		bool busy = (fx_run == c);
+		portEXIT_CRITICAL(&spinlock);
+		if (!busy) break;
+		vTaskDelay(1);
+	}
+
+	memset(c, 0, sizeof(*c));
+	for (uint32_t i = 0; i < n; i++) {
+		const sound_fx_t *fx = chain + i;
+		stage_t *f = c->stage + i;
+		int32_t err = -1;
+		f->type = fx->type;
+		f->budget = fx->budget;
+		switch (fx->type) {
+		case SOUND_FX_LPF:
+			err = fx_lpf_init(f, fx);
+			break;
+		case SOUND_FX_ECHO:
+			if (!echo) err = fx_echo_init(f, fx);
+			echo = true;
+			break;
+		case SOUND_FX_LIMIT:
+			if (!limit) err = fx_limit_init(c, fx);
+			limit = true;
+			break;
+		}
+		if (err) return -1;
+	}
+	c->n = n;
+	// Start the echo from silence. The old chain may still be echoing,
+	// which costs a block of noise at most.
+	if (echo) memset(line, 0, SOUND_FX_ECHO_LEN * sizeof(line[0]));
+
+	portENTER_CRITICAL(&spinlock);
+	fx_cur = c;
+	portEXIT_CRITICAL(&spinlock);
+	return 0;
+}
+
+// Copy the cost of an effect of the chain.
+// i: index of the effect in the chain.
+// st: where to put the cost.
+// Return zero if successful, or non-zero if there is no such effect.
+int32_t sound_fx_get_stats(uint32_t i, sound_fx_stats_t *st)
+{
+	int32_t err = -1;
+
+	portENTER_CRITICAL(&spinlock);
+	if (fx_cur && i < fx_cur->n) {
+		*st = fx_cur->stage[i].stats;
+		err = 0;
+	}
+	portEXIT_CRITICAL(&spinlock);
+	return err;
+}
@@ -0,0 +1,20 @@
+#ifndef SOUND_FX_H_
+#define SOUND_FX_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Output effects chain of the mixer (sound_fx_set() in sound.h).
+
+// Set the output sample rate that effects are tuned for. Call before
+// setting a chain.
+// hz: sample rate in Hz.
+void sound_fx_rate(uint32_t hz);
+
+// Run the chain over a mixed block. Safe to call from an IRAM ISR.
+// acc: signed 16-bit samples, processed in place.
+// len: number of samples.
+// Return true while an effect still has output after its input ends.
+bool sound_fx_run(int16_t *acc, uint32_t len);
+
+#endif // SOUND_FX_H_
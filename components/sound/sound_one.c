@@ -44,8 +44,7 @@ static volatile bool     cyclic;
 static dac_oneshot_handle_t dac_handle;
 static gptimer_handle_t dac_timer;
 static volatile bool device_en;
-static volatile uint32_t volume;
-static volatile uint8_t bias; // to prevent popping at end when vol low.
+static uint8_t vol_lut[256]; // sample scaled by volume, plus bias
 
 
 // DAC timer ISR callback
@@ -55,9 +54,9 @@ static bool IRAM_ATTR dac_timer_isr(gptimer_handle_t timer, const gptimer_alarm_
 	// portENTER_CRITICAL_ISR(&spinlock);
 	if (aidx < asize) {
 		uint32_t idx = aidx;
-		aidx =  cyclic ? (aidx + 1) % asize : aidx + 1;
+		aidx = (cyclic && idx+1 == asize) ? 0 : idx+1;
 		// portEXIT_CRITICAL_ISR(&spinlock);
-		dac_oneshot_output_voltage(dac_handle, abase[idx]*volume/PERCENT + bias);
+		dac_oneshot_output_voltage(dac_handle, vol_lut[abase[idx]]);
 	} else if (aidx == asize) {
 		aidx++;
 		// portEXIT_CRITICAL_ISR(&spinlock);
@@ -202,8 +201,10 @@ void sound_stop(void)
 // volume: 0-100% as an integer value.
 void sound_set_volume(uint32_t vol)
 {
-	volume = vol;
-	bias = SILENCE - (SILENCE * vol / PERCENT);
+	uint32_t bias = SILENCE - (SILENCE * vol / PERCENT); // to prevent popping at end when vol low.
+
+	// A sample may be played with a partly updated table, which is inaudible.
+	for (uint32_t s = 0; s < 256; s++) vol_lut[s] = s*vol/PERCENT + bias;
 }
 
 // Enable or disable the sound output device.
@@ -0,0 +1,207 @@
+// https://docs.espressif.com/projects/esp-idf/en/stable/esp32/api-reference/storage/partition.html
+
+#include <stdio.h> // fopen, fread
+#include <string.h> // memcpy, memset
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+
+#include "sound.h"
+
+#define BLK_SZ 512 // bytes fetched at a time
+#define BLK_NUM 4 // blocks in the ring
+#define RING_SZ (BLK_SZ*BLK_NUM) // 85 ms at 24 kHz
+#define STACK_SZ 3072 // prefetch task stack size
+#define PRIORITY 2 // prefetch task priority, below the application tasks
+#define POLL_DELAY 10
+#define SILENCE 0x80U
+
+static const char *TAG = "sound_stream";
+
+// Ring shared with the audio ISR. The task only writes head, the ISR
+// only writes tail. Both count bytes and wrap at 2^32.
+static uint8_t ring[RING_SZ];
+static _Atomic uint32_t head;
+static _Atomic uint32_t tail;
+static atomic_bool eof; // no more data after head
+static _Atomic uint32_t underruns;
+static TaskHandle_t volatile task_h;
+static volatile bool quit;
+static sound_voice_t voice = -1;
+
+// Source, only used by the opener and the prefetch task
+static FILE *file;
+static const uint8_t *map; // mapped partition audio
+static esp_partition_mmap_handle_t map_h;
+static uint32_t src_size, src_pos;
+static bool src_loop;
+
+
+// Copy samples from the ring for the audio ISR. When the ring runs dry
+// before the end of the stream, pad with silence and count an underrun.
+static uint32_t IRAM_ATTR stream_fill(void *ctx, uint8_t *buf, uint32_t len)
+{
+	bool end = atomic_load_explicit(&eof, memory_order_acquire); // before head
+	uint32_t t = atomic_load_explicit(&tail, memory_order_relaxed);
+	uint32_t avail = atomic_load_explicit(&head, memory_order_acquire) - t;
+	uint32_t n = (avail < len) ? avail : len;
+	uint32_t i = t % RING_SZ, seg = RING_SZ - i;
+
+	if (seg > n) seg = n;
+	memcpy(buf, ring+i, seg);
+	memcpy(buf+seg, ring, n-seg);
+	atomic_store_explicit(&tail, t+n, memory_order_release);
+	TaskHandle_t th = task_h;
+	if (th && (t+n)/BLK_SZ != t/BLK_SZ) vTaskNotifyGiveFromISR(th, NULL);
+	if (n < len && !end) {
+		atomic_fetch_add_explicit(&underruns, 1, memory_order_relaxed);
+		sound_underrun();
+		memset(buf+n, SILENCE, len-n);
+		n = len;
+	}
+	return n;
+}
+
+// Read up to len bytes from the source, rewinding if looping.
+// Return the number of bytes read, less than len at the end.
+static uint32_t stream_read(uint8_t *dst, uint32_t len)
+{
+	uint32_t n = 0;
+
+	while (n < len) {
+		if (src_pos == src_size) {
+			if (!src_loop || src_size == 0) break;
+			src_pos = 0;
+			if (file) fseek(file, 0, SEEK_SET);
+		}
+		uint32_t k = len - n;
+		if (k > src_size - src_pos) k = src_size - src_pos;
+		if (file) {
+			k = fread(dst+n, 1, k, file);
+			if (k == 0) break; // read error, end the stream
+		} else {
+			memcpy(dst+n, map+src_pos, k);
+		}
+		n += k;
+		src_pos += k;
+	}
+	return n;
+}
+
+// Close the file or unmap the partition.
+static void stream_release(void)
+{
+	if (file) fclose(file);
+	if (map) esp_partition_munmap(map_h);
+	file = NULL;
+	map = NULL;
+}
+
+// Keep the ring full one block at a time, woken by the ISR each time it
+// frees a block.
+static void stream_task(void *pvParameters)
+{
+	while (!quit) {
+		uint32_t h = atomic_load_explicit(&head, memory_order_relaxed);
+		if (atomic_load(&eof) ||
+			h - atomic_load_explicit(&tail, memory_order_acquire) > RING_SZ - BLK_SZ) {
+			ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(POLL_DELAY));
+			continue;
+		}
+		uint32_t n = stream_read(ring + h % RING_SZ, BLK_SZ);
+		atomic_store_explicit(&head, h+n, memory_order_release);
+		if (n < BLK_SZ) atomic_store_explicit(&eof, true, memory_order_release);
+	}
+	stream_release();
+	task_h = NULL;
+	vTaskDelete(NULL);
+}
+
+// Open an audio stream and play it on a voice. Samples are copied ahead of
+// the audio ISR into a RAM ring by a low priority prefetch task, so the
+// audio does not have to fit in the app image. Only one stream is open
+// at a time, opening another closes the first.
+// src: a file path starting with '/' (e.g. "/spiffs/song.u8") holding raw
+// unsigned audio, or the label of a data partition (e.g. "storage") holding
+// the byte count as a 32-bit little endian word followed by the audio.
+// vol: voice volume 0-100% as an integer value.
+// loop: if true, play cyclically until closed, otherwise play once.
+// prio: priority of the voice, higher is more important.
+// Return a voice handle, or a negative value if not successful.
+sound_voice_t sound_stream_open(const char *src, uint32_t vol, bool loop, uint8_t prio)
+{
+	sound_stream_close();
+	if (src == NULL) return -1;
+	if (src[0] == '/') {
+		file = fopen(src, "rb");
+		if (file == NULL) {
+			ESP_LOGE(TAG, "can't open %s", src);
+			return -1;
+		}
+		fseek(file, 0, SEEK_END);
+		src_size = ftell(file);
+		fseek(file, 0, SEEK_SET);
+	} else {
+		const esp_partition_t *part = esp_partition_find_first(
+			ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, src);
+		const void *p;
+		uint32_t size;
+		if (part == NULL) {
+			ESP_LOGE(TAG, "no partition %s", src);
+			return -1;
+		}
+		if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &p, &map_h) != ESP_OK) {
+			ESP_LOGE(TAG, "can't map %s", src);
+			return -1;
+		}
+		map = (const uint8_t *)p + sizeof(size);
+		memcpy(&size, p, sizeof(size));
+		if (size > part->size - sizeof(size)) {
+			ESP_LOGE(TAG, "bad audio size in %s", src);
+			stream_release();
+			return -1;
+		}
+		src_size = size;
+	}
+	src_pos = 0;
+	src_loop = loop;
+
+	// Fill the ring before starting so the first blocks don't underrun.
+	uint32_t n = stream_read(ring, RING_SZ);
+	atomic_store(&head, n);
+	atomic_store(&tail, 0);
+	atomic_store(&eof, n < RING_SZ);
+	atomic_store(&underruns, 0);
+	quit = false;
+	TaskHandle_t th;
+	if (xTaskCreate(stream_task, "sound_stream", STACK_SZ, NULL, PRIORITY, &th) != pdPASS) {
+		ESP_LOGE(TAG, "prefetch task create fail");
+		stream_release();
+		return -1;
+	}
+	task_h = th;
+	voice = sound_play_source(stream_fill, NULL, vol, prio);
+	if (voice < 0) sound_stream_close();
+	return voice;
+}
+
+// Stop the stream and free its resources.
+void sound_stream_close(void)
+{
+	sound_voice_stop(voice);
+	voice = -1;
+	if (task_h == NULL) return;
+	quit = true;
+	xTaskNotifyGive(task_h);
+	while (task_h != NULL) vTaskDelay(pdMS_TO_TICKS(POLL_DELAY));
+}
+
+// Return the number of DMA blocks padded with silence because the
+// prefetch task fell behind, since the stream was opened.
+uint32_t sound_stream_underruns(void)
+{
+	return atomic_load_explicit(&underruns, memory_order_relaxed);
+}
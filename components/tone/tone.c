@@ -1,24 +1,362 @@
-#include <stdlib.h> 
+#include <stdlib.h>
 #include <math.h>
 #include "tone.h"
 
-#define BUFFER_DIVISOR 20       // Divisor to determine buffer size from sample rate
-#define DAC_MAX_VAL 255         // The maximum value for the DAC output
+#define TABLE_BITS 8            // log2 of the wavetable size
+#define TABLE_SZ (1U << TABLE_BITS) // Entries in one period of a wavetable
+#define PHASE_SHIFT (32 - TABLE_BITS) // Phase bits below the table index
+#define HARMONICS (TABLE_SZ / 2 - 1) // Most harmonics a wavetable can hold
+#define LEVELS 8                // Band-limited tables per waveform, one per octave
+#define FULL_BIT (31 - TABLE_BITS) // Highest phase step bit of the full table
 #define DAC_MID_VAL 128         // The midpoint (offset) for the DAC output
 #define DAC_AMPLITUDE 127       // The amplitude of the waveform (max value - mid value)
-#define PI_FLOAT 3.14159f       // Define PI for float calculations
+#define PI_FLOAT 3.14159265f    // Define PI for float calculations
 #define TWO_PI_FLOAT (2.0f * PI_FLOAT)
-#define DAC_MAX_VAL_FLOAT 255.0f         // The maximum value for the DAC output
-#define DAC_MID_VAL_FLOAT 128.0f         // The midpoint (offset) for the DAC output
-#define DAC_AMPLITUDE_FLOAT 127.0f       // The amplitude of the waveform (max value - mid value)
-#define WAVE_QUARTER_DIVISOR 4
-#define TRIANGLE_WAVE_THIRD_QUARTER 3
-
-// A global pointer for our waveform data buffer
-static uint8_t *g_waveform_buffer = NULL;
+#define TONE_PRIORITY 1         // Voice priority of the tone
+#define NOTES 128               // MIDI note numbers
+#define NOTE_A4 69              // MIDI note number of A4
+#define FREQ_A4 440.0f          // Frequency of A4 in Hz
+#define SEMITONES 12.0f         // Semitones per octave
+#define ENV_ONE (1U << 24)      // Full envelope level, Q24
+#define ENV_SHIFT 16            // Envelope level to a Q8 gain
+#define PERCENT 100U
+#define MS_PER_S 1000U
+
+// Oscillator state, shared between the tasks and the audio ISR
+typedef struct {
+    uint32_t phase;             // Position in the period, 2^32 is a full period
+    uint32_t inc;               // Phase step per sample
+    int32_t dinc;               // Change of inc per sample while sweeping
+    uint32_t sweep;             // Samples left in the sweep
+    uint32_t target;            // inc at the end of the sweep
+    tone_t wave;                // Waveform being played
+    uint32_t gen;               // Changed each time a task updates the oscillator
+} osc_t;
+
+// Envelope stages
+typedef enum {ENV_OFF, ENV_ATTACK, ENV_DECAY, ENV_SUSTAIN, ENV_RELEASE} stage_t;
+
+// Sequencer state, shared between the tasks and the audio ISR
+typedef struct {
+    const tone_note_t *pattern; // Notes being played
+    const tone_note_t *next;    // Note after the one playing
+    const tone_env_t *envs;     // Envelopes of the pattern
+    uint32_t tick;              // Samples per tick
+    bool loop;                  // Repeat the pattern at the end
+    uint32_t phase;             // Oscillator phase
+    uint32_t inc;               // Oscillator phase step per sample
+    const uint8_t *table;       // Wavetable of the note
+    uint32_t left;              // Samples left in the note
+    uint32_t gate;              // Samples left before the release
+    stage_t stage;              // Envelope stage
+    uint32_t level;             // Envelope level, Q24
+    uint32_t rate;              // Envelope change per sample, Q24
+    uint32_t sustain;           // Sustain level, Q24
+    uint32_t decay_rate;        // Envelope fall per sample in the decay, Q24
+    uint32_t release;           // Samples in the release
+    uint32_t gen;               // Changed each time a task starts a pattern
+} seq_t;
+
+// One period of each waveform, indexed by the top bits of the phase.
+// Square, triangle and saw have a table for each octave, holding only
+// the harmonics below the Nyquist frequency anywhere in that octave.
+static DRAM_ATTR uint8_t g_sine[TABLE_SZ];
+static DRAM_ATTR uint8_t g_tables[LAST_T - SQUARE_T][LEVELS][TABLE_SZ];
 static uint32_t g_sample_rate = 0;
 
-// Initializes the sound generation component and allocates the waveform buffer.
+#ifdef SOUND_ONESHOT
+// Oscillator, played one period at a time by sound_cyclic()
+static osc_t g_osc;
+static uint8_t *g_period = NULL; // One period of the tone
+#else
+// Oscillator and its lock
+static portMUX_TYPE g_lock = portMUX_INITIALIZER_UNLOCKED;
+static osc_t g_osc;
+static sound_voice_t g_voice = -1;
+
+// Sequencer, protected by the same lock
+static seq_t g_seq;
+static sound_voice_t g_seq_voice = -1;
+static DRAM_ATTR uint32_t g_note_inc[NOTES]; // Phase step of each note
+static uint32_t g_ms_q16;       // Samples per millisecond, Q16
+#endif
+
+
+// Amplitude of harmonic h of a waveform with a peak of 1, in sine phase.
+static float tone_harmonic(tone_t tone, uint32_t h)
+{
+    switch (tone)
+    {
+        case SQUARE_T:
+            return (h & 1) ? 4.0f / (PI_FLOAT * h) : 0.0f;
+        case TRIANGLE_T:
+            // Odd harmonics of alternating sign
+            return (h & 1) ? ((h & 2) ? -8.0f : 8.0f) / (PI_FLOAT * PI_FLOAT * h * h) : 0.0f;
+        case SAW_T:
+            // Rises from the midpoint, drops at half of the period
+            return ((h & 1) ? 2.0f : -2.0f) / (PI_FLOAT * h);
+        default:
+            return (h == 1) ? 1.0f : 0.0f;
+    }
+}
+
+// Fill the wavetables by adding up harmonics of a sine table. Each holds
+// exactly one period, so the oscillator can step through it at any rate.
+// Level k holds the harmonics below the Nyquist frequency for phase
+// steps below 2^(FULL_BIT+1+k), level 0 all that fit in the table.
+// Returns zero if successful, or non-zero if out of memory.
+static int32_t tone_make_tables(void)
+{
+    // Work space, only needed while building the tables
+    float *sine = malloc(2 * TABLE_SZ * sizeof(float));
+    float *sum = sine + TABLE_SZ;
+
+    if (sine == NULL)
+    {
+        return -1;
+    }
+    for (uint32_t i = 0; i < TABLE_SZ; i++)
+    {
+        // Calculate the SIN value (-1.0, 1.0) for this entry
+        sine[i] = sinf(TWO_PI_FLOAT * i / TABLE_SZ);
+        g_sine[i] = (uint8_t)lrintf(DAC_MID_VAL + DAC_AMPLITUDE * sine[i]);
+    }
+    for (tone_t t = SQUARE_T; t < LAST_T; t++)
+    {
+        for (uint32_t k = 0; k < LEVELS; k++)
+        {
+            uint32_t top = (k == 0) ? HARMONICS : (1U << (LEVELS - 1 - k));
+            float peak = 0.0f;
+
+            for (uint32_t i = 0; i < TABLE_SZ; i++)
+            {
+                sum[i] = 0.0f;
+                // Harmonic h of entry i is entry h*i of the sine table
+                for (uint32_t h = 1; h <= top; h++)
+                {
+                    sum[i] += tone_harmonic(t, h) * sine[(h * i) % TABLE_SZ];
+                }
+                if (fabsf(sum[i]) > peak)
+                {
+                    peak = fabsf(sum[i]);
+                }
+            }
+            // Scale to full range, the band limit rings over the peak
+            for (uint32_t i = 0; i < TABLE_SZ; i++)
+            {
+                g_tables[t - SQUARE_T][k][i] = (uint8_t)lrintf(DAC_MID_VAL + DAC_AMPLITUDE * sum[i] / peak);
+            }
+        }
+    }
+    free(sine);
+    return 0;
+}
+
+// Wavetable for a waveform played with a phase step. The octave is found
+// from the highest set bit of the step.
+static inline const uint8_t * IRAM_ATTR tone_table(tone_t tone, uint32_t inc)
+{
+    if (tone == SINE_T)
+    {
+        return g_sine;
+    }
+    uint32_t bit = inc ? 31 - __builtin_clz(inc) : 0;
+    uint32_t k = (bit > FULL_BIT) ? bit - FULL_BIT : 0;
+    return g_tables[tone - SQUARE_T][(k < LEVELS) ? k : LEVELS - 1];
+}
+
+// Phase step per sample for a frequency in Hz.
+static uint32_t tone_inc(uint32_t freq)
+{
+    return (uint32_t)(((uint64_t)freq << 32) / g_sample_rate);
+}
+
+#ifdef SOUND_ONESHOT
+// Render one period of a tone from its wavetable and play it cyclically.
+// The timer driver has no mixer, so the frequency is rounded to a whole
+// number of samples per period and a change restarts the period.
+static void tone_cycle(tone_t tone, uint32_t freq)
+{
+    uint32_t period = g_sample_rate / freq;
+    uint32_t inc = (uint32_t)((1ULL << 32) / period);
+    const uint8_t *table = tone_table(tone, tone_inc(freq));
+
+    for (uint32_t i = 0; i < period; i++)
+    {
+        g_period[i] = table[(i * inc) >> PHASE_SHIFT];
+    }
+    sound_cyclic(g_period, period);
+}
+#else
+// Audio source for the tone voice, called from the audio ISR once per
+// DMA block. Steps the phase accumulator through the wavetable, chosen
+// for the octave once per block.
+static uint32_t IRAM_ATTR tone_fill(void *ctx, uint8_t *buf, uint32_t len)
+{
+    osc_t o;
+
+    portENTER_CRITICAL_ISR(&g_lock);
+    o = g_osc;
+    portEXIT_CRITICAL_ISR(&g_lock);
+
+    const uint8_t *table = tone_table(o.wave, o.inc);
+    for (uint32_t i = 0; i < len; i++)
+    {
+        buf[i] = table[o.phase >> PHASE_SHIFT];
+        o.phase += o.inc;
+        if (o.sweep)
+        {
+            o.inc = (--o.sweep) ? o.inc + o.dinc : o.target;
+        }
+    }
+
+    // Keep a change made by a task meanwhile, but not a phase jump
+    portENTER_CRITICAL_ISR(&g_lock);
+    g_osc.phase = o.phase;
+    if (g_osc.gen == o.gen)
+    {
+        g_osc.inc = o.inc;
+        g_osc.sweep = o.sweep;
+    }
+    portEXIT_CRITICAL_ISR(&g_lock);
+    return len;
+}
+
+// Convert milliseconds to samples, without a division for the ISR.
+static inline uint32_t IRAM_ATTR tone_samples(uint32_t ms)
+{
+    return (uint32_t)(((uint64_t)ms * g_ms_q16) >> 16);
+}
+
+// Envelope change per sample to cover a distance in a time.
+static inline uint32_t IRAM_ATTR tone_rate(uint32_t dist, uint32_t samples)
+{
+    return samples ? dist / samples : dist;
+}
+
+// Start the next note of the pattern, or return false at its end.
+static bool IRAM_ATTR tone_seq_note(seq_t *s)
+{
+    const tone_note_t *n = s->next;
+
+    if (n->note == TONE_END)
+    {
+        if (!s->loop || n == s->pattern)
+        {
+            return false;
+        }
+        n = s->pattern;
+    }
+    s->next = n + 1;
+    s->left = n->ticks * s->tick;
+    if (n->note == TONE_REST || n->note >= NOTES || n->wave >= LAST_T)
+    {
+        s->stage = ENV_OFF;
+        s->level = 0;
+        s->gate = 0;
+        return true;
+    }
+
+    // The release takes the end of the note, up to half of it
+    const tone_env_t *e = s->envs + n->env;
+    uint32_t attack = tone_samples(e->attack_ms);
+    s->release = tone_samples(e->release_ms);
+    if (s->release > s->left / 2)
+    {
+        s->release = s->left / 2;
+    }
+    s->gate = s->left - s->release;
+    s->sustain = (e->sustain < PERCENT) ? e->sustain * ENV_ONE / PERCENT : ENV_ONE;
+    s->decay_rate = tone_rate(ENV_ONE - s->sustain, tone_samples(e->decay_ms));
+    s->inc = g_note_inc[n->note];
+    s->table = tone_table(n->wave, s->inc);
+    s->stage = ENV_ATTACK;
+    s->level = 0; // the phase carries on, the envelope avoids the click
+    s->rate = tone_rate(ENV_ONE, attack);
+    return true;
+}
+
+// Step the envelope by one sample.
+static inline void IRAM_ATTR tone_seq_env(seq_t *s)
+{
+    if (s->gate == 0 && s->stage != ENV_OFF && s->stage != ENV_RELEASE)
+    {
+        s->stage = ENV_RELEASE;
+        s->rate = tone_rate(s->level, s->release);
+    }
+    switch (s->stage)
+    {
+        case ENV_ATTACK:
+            if (s->level < ENV_ONE - s->rate)
+            {
+                s->level += s->rate;
+                break;
+            }
+            s->level = ENV_ONE;
+            s->stage = ENV_DECAY;
+            s->rate = s->decay_rate;
+            break;
+        case ENV_DECAY:
+            if (s->level > s->sustain + s->rate)
+            {
+                s->level -= s->rate;
+                break;
+            }
+            s->level = s->sustain;
+            s->stage = ENV_SUSTAIN;
+            break;
+        case ENV_RELEASE:
+            s->level = (s->level > s->rate) ? s->level - s->rate : 0;
+            break;
+        default:
+            break;
+    }
+    if (s->gate)
+    {
+        s->gate--;
+    }
+}
+
+// Audio source for the sequencer voice, called from the audio ISR once
+// per DMA block. Starts notes as they come due and applies the envelope.
+// Returns fewer samples than asked for at the end of the pattern.
+static uint32_t IRAM_ATTR tone_seq_fill(void *ctx, uint8_t *buf, uint32_t len)
+{
+    seq_t s;
+    uint32_t i;
+
+    portENTER_CRITICAL_ISR(&g_lock);
+    s = g_seq;
+    portEXIT_CRITICAL_ISR(&g_lock);
+    if (s.gen != (uint32_t)(uintptr_t)ctx)
+    {
+        return 0; // replaced by another pattern
+    }
+
+    for (i = 0; i < len; i++)
+    {
+        if (s.left == 0 && !tone_seq_note(&s))
+        {
+            break;
+        }
+        tone_seq_env(&s);
+        int32_t v = s.table ? s.table[s.phase >> PHASE_SHIFT] - DAC_MID_VAL : 0;
+        buf[i] = DAC_MID_VAL + (v * (int32_t)(s.level >> ENV_SHIFT) >> 8);
+        s.phase += s.inc;
+        s.left--;
+    }
+
+    portENTER_CRITICAL_ISR(&g_lock);
+    if (g_seq.gen == s.gen)
+    {
+        g_seq = s;
+    }
+    portEXIT_CRITICAL_ISR(&g_lock);
+    return i;
+}
+#endif
+
+// Initializes the sound generation component and the wavetables.
 int32_t tone_init(uint32_t sample_hz)
 {
     // Set min sample rate
@@ -28,146 +366,191 @@ int32_t tone_init(uint32_t sample_hz)
     if (sample_hz < min_sample_rate)
     {
         return -1;
-    } 
+    }
 
     // Add sample_hz to global variable
     g_sample_rate = sample_hz;
-
-    // Init sound component
-    sound_init(sample_hz);
-    
-    // Buffer size
-    uint32_t buffer_size = sample_hz / 20;
-    
-    // Allocate buffer 
-    g_waveform_buffer = (uint8_t *)malloc(buffer_size * sizeof(uint8_t));
-    
-    // Check if the allocation was successful
-    if (g_waveform_buffer == NULL) 
+    if (tone_make_tables())
+    {
+        return -1;
+    }
+#ifdef SOUND_ONESHOT
+    // Longest period, at the lowest frequency
+    free(g_period);
+    g_period = malloc(sample_hz / LOWEST_FREQ);
+    if (g_period == NULL)
     {
         return -1;
     }
+#else
+    g_voice = -1;
+    g_seq_voice = -1;
+    g_ms_q16 = (uint32_t)(((uint64_t)sample_hz << 16) / MS_PER_S);
+    for (uint32_t n = 0; n < NOTES; n++)
+    {
+        float freq = FREQ_A4 * powf(2.0f, ((int32_t)n - NOTE_A4) / SEMITONES);
+        g_note_inc[n] = (uint32_t)(freq * 4294967296.0f / sample_hz);
+    }
+#endif
 
-    return 0;
+    // Init sound component
+    return sound_init(sample_hz);
 }
 
 
-// Frees the waveform buffer and deinitializes the sound component.
+// Deinitializes the sound component.
 int32_t tone_deinit(void)
 {
-        // Check if the pointer is valid before freeing
-    if (g_waveform_buffer != NULL) 
-    {
-        free(g_waveform_buffer);
-        // Set the pointer to NULL to prevent it from being used again
-        g_waveform_buffer = NULL;
-    }
-
-    sound_deinit();
-    
-    return 0;
+#ifdef SOUND_ONESHOT
+    free(g_period);
+    g_period = NULL;
+#else
+    g_voice = -1;
+    g_seq_voice = -1;
+#endif
+    return sound_deinit();
 }
 
 
-// Generates a waveform of a specific type and frequency and starts cyclic output.
+// Starts the tone, or changes its waveform and frequency if already
+// playing. The phase carries on, so there is no click.
 void tone_start(tone_t tone, uint32_t freq)
 {
     // Check the parameters are in bounds
-    if ((freq < LOWEST_FREQ) || (freq > (g_sample_rate / 2))) 
+    if ((freq < LOWEST_FREQ) || (freq > (g_sample_rate / 2)) || (tone >= LAST_T))
     {
         return;
     }
 
-    // Check if tone type is invalid
-    if (tone >= LAST_T) {
-        return;
+#ifdef SOUND_ONESHOT
+    g_osc.wave = tone;
+    tone_cycle(tone, freq);
+#else
+    portENTER_CRITICAL(&g_lock);
+    g_osc.wave = tone;
+    g_osc.inc = tone_inc(freq);
+    g_osc.sweep = 0;
+    g_osc.gen++;
+    portEXIT_CRITICAL(&g_lock);
+
+    if (!sound_voice_busy(g_voice))
+    {
+        g_osc.phase = 0;
+        g_voice = sound_play_source(tone_fill, NULL, MAX_VOL, TONE_PRIORITY);
     }
+#endif
+}
 
-        uint32_t samples_per_period = g_sample_rate / freq;
 
-    // Generate the waveform based on the selected tone type.
-    switch (tone)
+#ifndef SOUND_ONESHOT
+// Stops the tone on its own voice, leaving the other voices playing.
+void tone_stop(void)
+{
+    sound_voice_stop(g_voice);
+    g_voice = -1;
+}
+
+
+// Returns true while the tone's voice is playing.
+bool tone_busy(void)
+{
+    return sound_voice_busy(g_voice);
+}
+#endif
+
+
+// Changes the frequency of the playing tone at the next sample.
+void tone_set_freq(uint32_t freq)
+{
+    tone_sweep(freq, 0);
+}
+
+
+// Slides the frequency of the playing tone linearly to freq.
+void tone_sweep(uint32_t freq, uint32_t ms)
+{
+    if ((freq < LOWEST_FREQ) || (freq > (g_sample_rate / 2)))
     {
-        case SINE_T:
-                // Generate a sine wave period.
-                for (uint32_t i = 0; i < samples_per_period; i++)
-                {
-                    // Calculate the angle for this sample
-                    float angle = ((float)i / (samples_per_period)) * TWO_PI_FLOAT;
-                    // Calculate the SIN value (-1.0, 1.0)
-                    float sin_value = sinf(angle);
-                    // Find the associated DAC value
-                    g_waveform_buffer[i] = (uint8_t)(DAC_MID_VAL + (DAC_AMPLITUDE * sin_value));
-                }
-            break;
-        // Generate a square wave period.
-        case SQUARE_T:
-            for (uint32_t i = 0; i < samples_per_period; i++)
-            {
-                if (i < samples_per_period / 2)
-                {
-                    g_waveform_buffer[i] = DAC_MAX_VAL;
-                }
-                else
-                {
-                    g_waveform_buffer[i] = 0;
-                }
-            }
-            break;
-        // Generate a triangle wave period.
-        case TRIANGLE_T:
-            uint32_t quarter_period = samples_per_period / WAVE_QUARTER_DIVISOR;
-            if (quarter_period == 0) 
-            { 
-                quarter_period = 1; 
-            }
-            uint32_t half_period_tri = samples_per_period / 2;
-            uint32_t three_quarter_period = samples_per_period * TRIANGLE_WAVE_THIRD_QUARTER / WAVE_QUARTER_DIVISOR;
+        return;
+    }
 
-            for (uint32_t i = 0; i < samples_per_period; i++) 
-            {
-                if (i < quarter_period) 
-                {
-                    // Ramp up from 128 to 255
-                    g_waveform_buffer[i] = DAC_MID_VAL + (uint8_t)((DAC_AMPLITUDE_FLOAT / quarter_period) * i);
-                } 
-                else if (i < three_quarter_period) 
-                {
-                    // Ramp down from 255 to 0
-                    g_waveform_buffer[i] = DAC_MAX_VAL - (uint8_t)((DAC_MAX_VAL_FLOAT / half_period_tri) * (i - quarter_period));
-                }
-                else 
-                {
-                    // Ramp up from 0 to 128
-                    g_waveform_buffer[i] = (uint8_t)((DAC_MID_VAL_FLOAT / quarter_period) * (i - three_quarter_period));
-                }
-            }
-            break;
-        // Generate a sawtooth wave period.
-        case SAW_T:
-            uint32_t half_period_saw = samples_per_period / 2;
+#ifdef SOUND_ONESHOT
+    // No sweep without the mixer, jump to the end
+    if (sound_busy())
+    {
+        tone_cycle(g_osc.wave, freq);
+    }
+#else
+    uint32_t target = tone_inc(freq);
+    uint32_t samples = tone_samples(ms);
 
-            for (uint32_t i = 0; i < samples_per_period; i++)
-            {
-                if (i < half_period_saw) {
-                    // Ramp from 128 up to 255
-                    g_waveform_buffer[i] = DAC_MID_VAL + (uint8_t)((DAC_AMPLITUDE_FLOAT / half_period_saw) * i);
-                } 
-                else 
-                {
-                    // Ramp from 0 up to 128
-                    g_waveform_buffer[i] = (uint8_t)((DAC_MID_VAL_FLOAT / half_period_saw) * (i - half_period_saw));
-                
-                }
-            }
-            break;
+    portENTER_CRITICAL(&g_lock);
+    if (samples == 0)
+    {
+        g_osc.inc = target;
+        g_osc.sweep = 0;
+    }
+    else
+    {
+        g_osc.dinc = ((int64_t)target - g_osc.inc) / (int64_t)samples;
+        g_osc.target = target;
+        g_osc.sweep = samples;
+    }
+    g_osc.gen++;
+    portEXIT_CRITICAL(&g_lock);
+#endif
+}
 
-        default:
-            break;
+
+// Plays a pattern of notes on its own voice, sequenced in the audio ISR.
+int32_t tone_play(const tone_note_t *pattern, const tone_env_t *envs, uint32_t tick_ms, bool loop)
+{
+#ifdef SOUND_ONESHOT
+    return -1; // needs the mixer
+#else
+    if ((pattern == NULL) || (envs == NULL) || (tick_ms == 0) || (g_sample_rate == 0))
+    {
+        return -1;
     }
 
-    sound_cyclic(g_waveform_buffer, samples_per_period);
+    tone_play_stop();
+    portENTER_CRITICAL(&g_lock);
+    uint32_t gen = g_seq.gen + 1;
+    g_seq = (seq_t){
+        .pattern = pattern,
+        .next = pattern,
+        .envs = envs,
+        .tick = tone_samples(tick_ms),
+        .loop = loop,
+        .gen = gen,
+    };
+    portEXIT_CRITICAL(&g_lock);
+
+    g_seq_voice = sound_play_source(tone_seq_fill, (void *)(uintptr_t)gen, MAX_VOL, TONE_PRIORITY);
+    return (g_seq_voice < 0) ? -1 : 0;
+#endif
 }
 
 
+// Stops the pattern.
+void tone_play_stop(void)
+{
+#ifndef SOUND_ONESHOT
+    sound_voice_stop(g_seq_voice);
+    g_seq_voice = -1;
+    portENTER_CRITICAL(&g_lock);
+    g_seq.gen++; // a fill already running is discarded
+    portEXIT_CRITICAL(&g_lock);
+#endif
+}
+
 
+// Returns true while a pattern is playing.
+bool tone_play_busy(void)
+{
+#ifdef SOUND_ONESHOT
+    return false;
+#else
+    return sound_voice_busy(g_seq_voice);
+#endif
+}
@@ -4,21 +4,55 @@
 #include "sound.h"
 
 // This component is a thin layer around the sound component.
-// One cycle of a waveform is generated and then given to the
-// sound component to play out cyclically until told to stop.
+// A direct digital synthesis (DDS) oscillator plays on a voice of
+// the sound mixer: a 32-bit phase accumulator steps through a
+// 256-entry wavetable of one period, block by block in the audio
+// ISR. Any frequency is exact to within sample_hz/2^32, and changes
+// of frequency or waveform keep the phase, so they are click free.
+// Square, triangle and saw tables are band-limited, one per octave,
+// so high tones do not alias.
+// With the timer driver (sound_one.c, SOUND_ONESHOT) there is no
+// mixer: one period is rendered from the wavetable and played with
+// sound_cyclic(), so the frequency is rounded to a whole number of
+// samples, sweeps jump to the end and patterns are not played.
 // Macros are provided for tone functions that are aliases
-// of sound functions.
+// of sound functions. With the mixer, tone_stop() and tone_busy()
+// act on the tone's own voice only; with SOUND_ONESHOT they are
+// aliases of sound_stop() and sound_busy().
 
 #define LOWEST_FREQ 20U // Hz
 
+#ifdef SOUND_ONESHOT
 #define tone_stop() sound_stop()
 #define tone_busy() sound_busy()
+#endif
 #define tone_set_volume(vol) sound_set_volume(vol)
 #define tone_device(en) sound_device(en)
 
 // Tone waveforms
 typedef enum {SINE_T, SQUARE_T, TRIANGLE_T, SAW_T, LAST_T} tone_t;
 
+// Special note numbers of a pattern
+#define TONE_REST 0     // silence for the duration
+#define TONE_END 0xFF   // end of the pattern
+
+// ADSR envelope. The sustain level is held until the release, which
+// takes the last release_ms of each note.
+typedef struct {
+    uint16_t attack_ms;  // rise from zero to full level
+    uint16_t decay_ms;   // fall from full to the sustain level
+    uint8_t sustain;     // 0-100% of full level
+    uint16_t release_ms; // fall from the current level to zero
+} tone_env_t;
+
+// A note of a pattern, ended by a note of TONE_END.
+typedef struct {
+    uint8_t note;  // MIDI note number (69 is A4, 440 Hz), or TONE_REST
+    uint8_t wave;  // one of the enumerated tone types
+    uint8_t env;   // index of the envelope in the envelope array
+    uint8_t ticks; // duration in sequencer ticks
+} tone_note_t;
+
 // Initialize the tone driver. Must be called before using.
 // May be called again to change sample rate.
 // sample_hz: sample rate in Hz to playback tone.
@@ -29,9 +63,45 @@ int32_t tone_init(uint32_t sample_hz);
 // Return zero if successful, or non-zero otherwise.
 int32_t tone_deinit(void);
 
-// Start playing the specified tone.
+// Start playing the specified tone. If already playing, change to
+// the new waveform and frequency without restarting the period.
 // tone: one of the enumerated tone types.
 // freq: frequency of the tone in Hz.
 void tone_start(tone_t tone, uint32_t freq);
 
+#ifndef SOUND_ONESHOT
+// Stop the tone started by tone_start(). Other voices, such as a pattern
+// from tone_play(), keep playing.
+void tone_stop(void);
+
+// Return true if the tone started by tone_start() is playing, otherwise
+// return false.
+bool tone_busy(void);
+#endif
+
+// Change the frequency of the playing tone.
+// freq: frequency of the tone in Hz.
+void tone_set_freq(uint32_t freq);
+
+// Slide the frequency of the playing tone linearly, sample by sample.
+// freq: frequency in Hz at the end of the sweep.
+// ms: duration of the sweep in milliseconds.
+void tone_sweep(uint32_t freq, uint32_t ms);
+
+// Play a pattern of notes on its own voice. Notes are sequenced and
+// enveloped in the audio ISR, timed to the sample, with no work left
+// for the application. Playing another pattern replaces the first.
+// pattern: notes ended by TONE_END, must stay valid while playing.
+// envs: envelopes referenced by the notes, must stay valid while playing.
+// tick_ms: duration of a tick in milliseconds.
+// loop: if true, repeat the pattern until stopped, otherwise play once.
+// Return zero if successful, or non-zero otherwise.
+int32_t tone_play(const tone_note_t *pattern, const tone_env_t *envs, uint32_t tick_ms, bool loop);
+
+// Stop the pattern.
+void tone_play_stop(void);
+
+// Return true if a pattern is playing, otherwise return false.
+bool tone_play_busy(void);
+
 #endif // TONE_H_
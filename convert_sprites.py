@@ -6,14 +6,13 @@ Convert PNG sprite images to C arrays in RGB565 format.
 from PIL import Image
 import os
 
-def rgb888_to_rgb565(r, g, b):
-    """Convert 24-bit RGB to 16-bit RGB565."""
-    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3)
+from rgb565 import rgb888_to_rgb565, rgb888_to_rgb565_dither
 
-def convert_png_to_c(png_filename, output_name, bg_color=(0, 4, 16)):
+def convert_png_to_c(png_filename, output_name, bg_color=(0, 4, 16), dither=True):
     """
     Convert PNG to C array in RGB565 format.
     Pixels matching bg_color will be marked as transparent (0x0000 with special handling).
+    With dither, colors are ordered dithered instead of truncated.
     """
     # Open image
     img = Image.open(png_filename)
@@ -24,10 +23,12 @@ def convert_png_to_c(png_filename, output_name, bg_color=(0, 4, 16)):
     
     # Convert to RGB565
     rgb565_data = []
-    for r, g, b in pixels:
+    for i, (r, g, b) in enumerate(pixels):
         # Check if this is the background color (transparent)
         if (r, g, b) == bg_color:
             rgb565_data.append(0xFFFF)  # Use white/max value as "transparent" marker
+        elif dither:
+            rgb565_data.append(rgb888_to_rgb565_dither(r, g, b, i % width, i // width))
         else:
             rgb565_data.append(rgb888_to_rgb565(r, g, b))
     
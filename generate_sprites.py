@@ -1,11 +1,16 @@
 import os
 
+from rgb565 import rgb888_to_rgb565, rgb888_to_rgb565_dither
+
 # --- Configuration ---
 # Colors (R, G, B)
 BG_COLOR = (0, 4, 16)       # Background (matches config.h)
 SKIN_COLOR = (255, 200, 150)
 GLOVE_COLOR = (255, 0, 0)   # Red gloves/shoes
 
+# Ordered dither colors to RGB565 (False truncates, as before)
+DITHER = True
+
 # Character Themes
 COLOR_GOOD = (0, 255, 0)    # Green
 COLOR_BAD = (180, 0, 255)   # Purple
@@ -48,9 +53,6 @@ class Canvas:
                 y1 += sy
 
 # --- C Code Generation ---
-def rgb888_to_rgb565(r, g, b):
-    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3)
-
 def save_as_c(canvas, output_name):
     var_name = output_name.lower()
     macro_name = output_name.upper()
@@ -81,6 +83,8 @@ def save_as_c(canvas, output_name):
                 # Handle Transparency (Background color becomes 0xFFFF)
                 if (r, g, b) == BG_COLOR:
                     val = 0xFFFF
+                elif DITHER:
+                    val = rgb888_to_rgb565_dither(r, g, b, x, y)
                 else:
                     val = rgb888_to_rgb565(r, g, b)
                 
@@ -0,0 +1,113 @@
+% Clear command window & workspace, and close all figures
+clc, clear, close all;
+
+o_max_w = 320; % output image maximum width
+o_max_h = 240; % output image maximum height
+o_quality = 75; % output JPEG quality (0-100)
+o_dir = "jpeg"; % output sub-directory
+
+% Select image files to convert
+[fname,location] = uigetfile(...
+    '*.bmp;*.cur;*.gif;*.hdf4;*.ico;*.jpg;*.jpeg;*.pcx;*.pbm;*.pgm;*.png;*.ppm;*.ras;*.tif;*.tiff;*.xwd',...
+    'Select one or more image files',...
+    'MultiSelect','on');
+if isequal(fname,0) % user canceled selection
+    disp('No file(s) selected');
+    return;
+elseif ischar(fname) % convert to cell array if single file selected
+    fname = {fname};
+end
+
+% Create output sub-directory if nonexistent
+if not(isfolder(o_dir))
+    mkdir(o_dir);
+end
+
+% Process image data
+for i = 1:length(fname)
+    % read image file into a matrix
+    % returns: [image data, colormap values]
+    [x,cmap] = imread(fullfile(location,fname{i}));
+
+    % if indexed (colormapped) image, convert to 24-bit RGB
+    if numel(cmap) > 0
+        fprintf('Converting: %s to 24-bit RGB.\n', fname{i});
+        x = uint8(ind2rgb(x,cmap) .* 255);
+    end
+
+    % skip if not in 24-bit RGB format
+    if size(x,3) ~= 3 || ~isa(x,'uint8')
+        fprintf(' -- error: %s not in 24-bit RGB format.\n', fname{i});
+        continue
+    end
+
+    % resize image if a dimension is greater than maximum width or height
+    if size(x,2) > o_max_w || size(x,1) > o_max_h
+        fprintf('Resizing: %s\n', fname{i});
+        if size(x,2)/o_max_w > size(x,1)/o_max_h
+            xs = imresize(x,[NaN,o_max_w]);
+        else
+            xs = imresize(x,[o_max_h,NaN]);
+        end
+    else
+        xs = x;
+    end
+
+    % show the resized image
+    figure, imshow(xs);
+
+    % encode as baseline JPEG (4:2:0) and read back the file bytes
+    [path,name,ext] = fileparts(fname{i}); % split filename
+    path = fullfile(path,o_dir); % output to sub-directory
+    jname = fullfile(path,name+".jpg");
+    imwrite(xs,jname,'jpg','Quality',o_quality,'Mode','lossy');
+    fid = fopen(jname,'r');
+    xj = fread(fid,inf,'uint8=>uint8');
+    fclose(fid);
+    fprintf('%s: %u bytes (rgb565: %u bytes)\n', name, length(xj), size(xs,1)*size(xs,2)*2);
+
+    % save data to file in a 'C' array
+    dat2c(xj,path,name+"_jpg",size(xs,2),size(xs,1));
+end
+
+% Given a MATLAB array of JPEG file bytes, create a 'C' array in text.
+%   x: MATLAB array of uint8 data
+%   path: directory path to create 'C' file
+%   name: name of 'C' array and also files with .h and .c extension
+%   w: image width
+%   h: image height
+%   Returns the length of the MATLAB array
+function l = dat2c(x,path,name,w,h)
+    str = upper(name);
+
+    %%%%%%%%%%%%%%%%%%%% Write .h File %%%%%%%%%%%%%%%%%%%%
+    fid_h = fopen(fullfile(path,name+".h"), 'w');
+    fprintf(fid_h, "\n#include <stdint.h>\n\n");
+    fprintf(fid_h, "#define %s_SIZE %u\n", str, length(x));
+    fprintf(fid_h, "#define %s_W %u\n", str, w);
+    fprintf(fid_h, "#define %s_H %u\n\n", str, h);
+    fprintf(fid_h, "extern const uint8_t %s[%s_SIZE];\n", name, str);
+    fclose(fid_h);
+
+    %%%%%%%%%%%%%%%%%%%% Write .c File %%%%%%%%%%%%%%%%%%%%
+    ELEM_LINE = 16; % 'C' array elements per line
+    fid_c = fopen(fullfile(path,name+".c"), 'w');
+    pos = 0;
+    elem = length(x);
+
+    fprintf(fid_c, "\n#include <stdint.h>\n\n");
+    fprintf(fid_c, "const uint8_t %s[] = {\n", name); % start array
+    while elem > 0 % array data
+        if elem < ELEM_LINE; size = elem; else; size = ELEM_LINE; end
+        for i = 1:size
+            fprintf(fid_c, " 0x%02x,", x(pos+i));
+        end
+        pos = pos+size;
+        elem = elem-size;
+        fprintf(fid_c, "\n");
+    end
+    fprintf(fid_c, "};\n"); % end array
+    fclose(fid_c);
+
+    l = length(x);
+end
@@ -13,6 +13,7 @@
 #include "cursor.h"
 #include "joy.h"
 #include "uart.h"
+#include "perf.h"
 
 // include sound support
 
@@ -97,6 +98,10 @@ void app_main(void)
 	pin_reset(HW_BTN_START);
 	pin_input(HW_BTN_START, true);
 
+	// Performance overlay, toggled with the MENU button
+	CHK_RET(perf_init(HW_BTN_MENU, CONFIG_COLOR_BACKGROUND));
+	perf_set_pos(LCD_W - PERF_W, HEALTH_BAR_Y + HEALTH_BAR_H + 4);
+
 	// Initialize update timer
 	update_timer = xTimerCreate(
 		"update_timer",        // Text name for the timer.
@@ -131,6 +136,7 @@ void app_main(void)
 		t1 = esp_timer_get_time();
 		interrupt_flag = false;
 		isr_handled_count++;
+		perf_frame();
 
         // ====================================================================
         // STATE: START SCREEN
@@ -188,6 +194,7 @@ void app_main(void)
             }
             
             // Push frame to LCD
+            perf_draw();
             lcd_writeFrame();
         }
 
@@ -212,6 +219,7 @@ void app_main(void)
             // 3. Run Game Logic (Physics, Movement, Networking)
             // game_tick() handles com_write/com_read internally
             game_tick(); 
+            perf_mark("game");
 
 			// Check if game over
 			if (good_guy.health <= 0 || bad_guy.health <= 0)
@@ -232,8 +240,12 @@ void app_main(void)
                 lcd_drawString(5, 25, "WAITING FOR ACCEPT...", YELLOW);
             }
 
+            perf_mark("ui");
+
             // 5. Push frame to LCD
+            perf_draw();
             lcd_writeFrame();
+            perf_mark("flush");
 
             // 6. Handle Reset Transition
             // Check this AFTER game_tick so the "accept" packet has a chance to be sent
@@ -272,6 +284,7 @@ void app_main(void)
                 current_state = STATE_START_SCREEN;
             }
             
+            perf_draw();
             lcd_writeFrame();
         }
         // Timing Calculation
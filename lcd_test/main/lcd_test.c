@@ -12,6 +12,7 @@
 #include "lcd.h"
 #include "crosshair.h"
 #include "peppers.h"
+#include "peppers_jpg.h"
 
 // Time support
 #define TICKS_SEC 1000000LL
@@ -177,6 +178,27 @@ int64_t lcd_test_fillRect(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_fillRectGradient(void) {
+	int64_t startTick, endTick, diffTick, flatTick;
+
+	// Flat fill of the same area for comparison.
+	startTick = esp_timer_get_time();
+	lcd_fillRect(0, 0, width, height, BLACK);
+	flatTick = esp_timer_get_time() - startTick;
+
+	// Same dark ramp as lcd_test_colorBand, without the banding.
+	startTick = esp_timer_get_time();
+	lcd_fillRectGradient(0, 0, width, height/2, 0x000020, 0x4060FF, true);
+	lcd_fillRectGradient(0, height/2, width, height-height/2, 0x200000, 0x20FF40, false);
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	ESP_LOGI(__FUNCTION__, "flat fill time[us]:%"PRIi64, flatTick);
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 int64_t lcd_test_drawTriangle(void) {
 	int64_t startTick, endTick, diffTick;
 
@@ -419,6 +441,28 @@ int64_t lcd_test_drawBitmap(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_drawBitmapBg(void) {
+	int64_t startTick, endTick, diffTick;
+
+	color_t ctab[] = {RED,GREEN,BLUE,BLACK,GRAY,YELLOW,CYAN,MAGENTA};
+	lcd_fillScreen(BLACK);
+
+	startTick = esp_timer_get_time();
+	for (coord_t y = 0; y < LCD_H; y += CROSSHAIR_H+1) {
+		coord_t x;
+		uint8_t c;
+		for (x = 0, c = 0; x < LCD_W; x += CROSSHAIR_W+1, c++) {
+			lcd_drawBitmapBg(x, y, crosshair, CROSSHAIR_W, CROSSHAIR_H, ctab[c%8], ctab[(c+3)%8]);
+		}
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 int64_t lcd_test_drawRGBBitmap(void) {
 	int64_t startTick, endTick, diffTick;
 	coord_t x = 0, y = 0;
@@ -440,6 +484,56 @@ int64_t lcd_test_drawRGBBitmap(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_drawJpeg(void) {
+	int64_t startTick, endTick, diffTick;
+	coord_t x = 0, y = 0;
+
+	// Same path as lcd_test_drawRGBBitmap, decoding each time.
+	startTick = esp_timer_get_time();
+	for (; y < 10; y++)
+		lcd_drawJpeg(x, y, peppers_jpg, PEPPERS_JPG_SIZE);
+	for (; x < 10; x++)
+		lcd_drawJpeg(x, y, peppers_jpg, PEPPERS_JPG_SIZE);
+	for (; y > 0; y--)
+		lcd_drawJpeg(x, y, peppers_jpg, PEPPERS_JPG_SIZE);
+	for (; x > 0; x--)
+		lcd_drawJpeg(x, y, peppers_jpg, PEPPERS_JPG_SIZE);
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	ESP_LOGI(__FUNCTION__, "flash[bytes] rgb565:%u jpeg:%u saved:%u",
+		(unsigned)sizeof(peppers), (unsigned)PEPPERS_JPG_SIZE,
+		(unsigned)(sizeof(peppers)-PEPPERS_JPG_SIZE));
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
+int64_t lcd_test_fillPolygon(void) {
+	int64_t startTick, endTick, diffTick;
+
+	point_t pts[7];
+	lcd_fillScreen(CYAN);
+	srand((unsigned int)time(NULL));
+
+	startTick = esp_timer_get_time();
+	for (int32_t i = 0; i < 100; i++) {
+		for (int32_t j = 0; j < 7; j++) {
+			pts[j].x = rand() % width;
+			pts[j].y = rand() % height;
+		}
+		lcd_setFillRule((i & 1) ? FILL_NON_ZERO : FILL_EVEN_ODD);
+		lcd_fillPolygon(pts, 7, RAND_COLOR());
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_setFillRule(FILL_EVEN_ODD);
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 //----------------------------------------------------------------------------//
 // Rectangle variants that specify two diagonal corners
 //----------------------------------------------------------------------------//
@@ -615,6 +709,52 @@ int64_t lcd_test_drawRegularPolygonC(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_fillRegularPolygonC(void) {
+	int64_t startTick, endTick, diffTick;
+
+	color_t ctab[] = {GREEN,rgb565(4, 16, 64)};
+	uint8_t c = 0;
+	coord_t xpos = width/2;
+	coord_t ypos = height/2;
+	coord_t limit = width;
+	if (width > height) limit = height;
+	limit /= 2;
+	lcd_fillScreen(BLACK);
+
+	startTick = esp_timer_get_time();
+	for (coord_t n = 12; n >= 3; n--) {
+		coord_t radius = limit*n/12;
+		angle_t angle = n*10;
+		lcd_fillRegularPolygonC(xpos, ypos, n, radius, angle, ctab[c++%2]);
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
+int64_t lcd_test_drawSpriteTransformed(void) {
+	int64_t startTick, endTick, diffTick;
+
+	coord_t xpos = width/2;
+	coord_t ypos = height/2;
+	lcd_fillScreen(BLACK);
+
+	startTick = esp_timer_get_time();
+	for (angle_t angle = 0; angle < 360; angle += 30) {
+		int32_t scale = LCD_SCALE_ONE/4 + angle*(LCD_SCALE_ONE/2)/360;
+		lcd_drawSpriteTransformed(xpos, ypos, peppers, PEPPERS_W, PEPPERS_H, scale, angle, (angle/30) & 1);
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 //----------------------------------------------------------------------------//
 // Draw characters and strings
 //----------------------------------------------------------------------------//
@@ -650,6 +790,55 @@ int64_t lcd_test_drawString(void) {
 	return diffTick;
 }
 
+int64_t lcd_test_drawInt(void) {
+	int64_t startTick, endTick, diffTick;
+
+	lcd_fillScreen(BLACK);
+	lcd_setFontSize(1);
+	lcd_noFontBackground();
+
+	coord_t cols = width / (LCD_CHAR_W*8);
+	coord_t rows = height / LCD_CHAR_H;
+	int32_t value = -1000000;
+
+	startTick = esp_timer_get_time();
+	for (coord_t r = 0; r < rows; r++) {
+		for (coord_t c = 0; c < cols; c++, value += 12345) {
+			if (c & 1) lcd_drawFixed(c*LCD_CHAR_W*8, r*LCD_CHAR_H, value, 2, YELLOW);
+			else lcd_drawInt(c*LCD_CHAR_W*8, r*LCD_CHAR_H, value, WHITE);
+		}
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
+int64_t lcd_test_fieldUpdate(void) {
+	int64_t startTick, endTick, diffTick;
+
+	lcd_field_t counter, timer;
+	lcd_fillScreen(BLACK);
+	lcd_setFontSize(2);
+	lcd_fieldInit(&counter, 0, 0, 6, 0, GREEN, BLACK);
+	lcd_fieldInit(&timer, 0, LCD_CHAR_H*2, 8, 3, CYAN, BLACK);
+
+	// Count up like a HUD, only the low digits change on most updates.
+	startTick = esp_timer_get_time();
+	for (int32_t i = 0; i < 1000; i++) {
+		lcd_fieldUpdate(&counter, i);
+		lcd_fieldUpdate(&timer, i*40);
+	}
+	endTick = esp_timer_get_time();
+
+	lcd_writeFrame();
+	diffTick = endTick - startTick;
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 //----------------------------------------------------------------------------//
 // Font parameters
 //----------------------------------------------------------------------------//
@@ -773,6 +962,36 @@ int64_t lcd_test_wrapAround(void) {
 	return diffTick;
 }
 
+//----------------------------------------------------------------------------//
+// Display configuration
+//----------------------------------------------------------------------------//
+
+int64_t lcd_test_setRotation(void) {
+	int64_t startTick, endTick, diffTick = 0;
+	char ascii[16];
+
+	direction_t rot0 = lcd_getRotation();
+	for (uint32_t i = 0; i < 4; i++) {
+		lcd_setRotation((rot0+i) & 3);
+		coord_t w = lcd_getWidth();
+		coord_t h = lcd_getHeight();
+		lcd_fillScreen(BLACK);
+		startTick = esp_timer_get_time();
+		lcd_drawRGBBitmap(0, 0, peppers, PEPPERS_W, PEPPERS_H);
+		endTick = esp_timer_get_time();
+		diffTick += endTick - startTick;
+		lcd_drawRect(0, 0, w, h, YELLOW);
+		sprintf(ascii, "rot:%d %dx%d", (int)lcd_getRotation(), (int)w, (int)h);
+		lcd_drawString(4, h-LCD_CHAR_H-4, ascii, WHITE);
+		lcd_writeFrame();
+		WAIT;
+	}
+	lcd_setRotation(rot0);
+
+	PRINT_TIME(diffTick);
+	return diffTick;
+}
+
 // lcd_test_writeFrame
 
 //----------------------------------------------------------------------------//
@@ -790,6 +1009,7 @@ void lcd_test_all(void *pvParameters)
 		lcd_test_drawLine(); WAIT;
 		lcd_test_drawRect(); WAIT;
 		lcd_test_fillRect(); WAIT;
+		lcd_test_fillRectGradient(); WAIT;
 		lcd_test_drawTriangle(); WAIT;
 		lcd_test_fillTriangle(); WAIT;
 		lcd_test_drawCircle(); WAIT;
@@ -798,8 +1018,11 @@ void lcd_test_all(void *pvParameters)
 		lcd_test_fillRoundRect(); WAIT;
 		lcd_test_drawArrow(); WAIT;
 		lcd_test_fillArrow(); WAIT;
+		lcd_test_fillPolygon(); WAIT;
 		lcd_test_drawBitmap(); WAIT;
+		lcd_test_drawBitmapBg(); WAIT;
 		lcd_test_drawRGBBitmap(); WAIT;
+		lcd_test_drawJpeg(); WAIT;
 		lcd_test_drawRect2(); WAIT;
 		lcd_test_fillRect2(); WAIT;
 		lcd_test_drawRoundRect2(); WAIT;
@@ -807,10 +1030,15 @@ void lcd_test_all(void *pvParameters)
 		lcd_test_drawRectC(); WAIT;
 		lcd_test_drawTriangleC(); WAIT;
 		lcd_test_drawRegularPolygonC(); WAIT;
+		lcd_test_fillRegularPolygonC(); WAIT;
+		lcd_test_drawSpriteTransformed(); WAIT;
 		lcd_test_drawString(); WAIT;
+		lcd_test_drawInt(); WAIT;
+		lcd_test_fieldUpdate(); WAIT;
 		lcd_test_setFontDirection(); WAIT;
 		lcd_test_setFontSize(); WAIT;
 		lcd_test_wrapAround(); WAIT;
+		lcd_test_setRotation(); WAIT;
 		if (lcd_getFrameBuffer() == NULL) lcd_frameEnable();
 		else lcd_frameDisable();
 	}
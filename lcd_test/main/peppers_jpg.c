@@ -0,0 +1,730 @@
+
+#include <stdint.h>
+
+const uint8_t peppers_jpg[] = {
+ 0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43, 0x00, 0x08, 0x06, 0x06, 0x07, 0x06, 0x05, 0x08,
+ 0x07, 0x07, 0x07, 0x09, 0x09, 0x08, 0x0a, 0x0c, 0x14, 0x0d, 0x0c, 0x0b, 0x0b, 0x0c, 0x19, 0x12,
+ 0x13, 0x0f, 0x14, 0x1d, 0x1a, 0x1f, 0x1e, 0x1d, 0x1a, 0x1c, 0x1c, 0x20, 0x24, 0x2e, 0x27, 0x20,
+ 0x22, 0x2c, 0x23, 0x1c, 0x1c, 0x28, 0x37, 0x29, 0x2c, 0x30, 0x31, 0x34, 0x34, 0x34, 0x1f, 0x27,
+ 0x39, 0x3d, 0x38, 0x32, 0x3c, 0x2e, 0x33, 0x34, 0x32, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x09, 0x09,
+ 0x09, 0x0c, 0x0b, 0x0c, 0x18, 0x0d, 0x0d, 0x18, 0x32, 0x21, 0x1c, 0x21, 0x32, 0x32, 0x32, 0x32,
+ 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+ 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+ 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0xff, 0xc0,
+ 0x00, 0x11, 0x08, 0x00, 0xf0, 0x01, 0x40, 0x03, 0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11,
+ 0x01, 0xff, 0xc4, 0x00, 0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+ 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00, 0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+ 0x05, 0x04, 0x04, 0x00, 0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+ 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xa1, 0x08, 0x23,
+ 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17,
+ 0x18, 0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+ 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+ 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+ 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+ 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7,
+ 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5,
+ 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+ 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00, 0x1f, 0x01, 0x00, 0x03,
+ 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+ 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+ 0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00, 0x01, 0x02, 0x77, 0x00,
+ 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13,
+ 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+ 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27,
+ 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+ 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+ 0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88,
+ 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,
+ 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+ 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2,
+ 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9,
+ 0xfa, 0xff, 0xda, 0x00, 0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xf2,
+ 0xb1, 0x4e, 0x18, 0xf4, 0xa4, 0xc1, 0xeb, 0x4a, 0xa0, 0x1e, 0x9f, 0x95, 0x74, 0x9d, 0x83, 0x87,
+ 0xbd, 0x29, 0x23, 0x14, 0xd2, 0x4e, 0x71, 0x8a, 0x39, 0xa0, 0x05, 0xeb, 0xc8, 0xa0, 0xaa, 0xb8,
+ 0xc3, 0x53, 0x93, 0xa5, 0x29, 0x1c, 0x7b, 0xd0, 0x05, 0x6f, 0x2d, 0x96, 0x4d, 0x9d, 0xbd, 0x6a,
+ 0x61, 0xc7, 0x02, 0x95, 0x94, 0x95, 0xcf, 0xa5, 0x00, 0x50, 0x21, 0x00, 0x07, 0xad, 0x21, 0x5c,
+ 0x53, 0x85, 0x03, 0x71, 0x27, 0xa6, 0x3d, 0x28, 0x18, 0xc1, 0x91, 0x4f, 0x19, 0xa5, 0xc6, 0x06,
+ 0x4f, 0x14, 0xa3, 0x91, 0xc8, 0xa0, 0x00, 0x0a, 0x76, 0x47, 0xd6, 0x90, 0x2e, 0x69, 0x76, 0x9a,
+ 0x00, 0x4d, 0x88, 0x7b, 0x63, 0xe9, 0x47, 0x95, 0xe8, 0xc7, 0xf1, 0xa7, 0x0e, 0x0d, 0x2d, 0x00,
+ 0x46, 0x51, 0x87, 0x5c, 0x11, 0x49, 0xc8, 0x35, 0x27, 0x24, 0xf3, 0x47, 0xb5, 0x00, 0x31, 0xb8,
+ 0x14, 0xda, 0x97, 0x68, 0x6e, 0xa2, 0x90, 0xc4, 0x3b, 0x36, 0x28, 0x01, 0x80, 0x73, 0x4b, 0xd7,
+ 0x8a, 0x5f, 0x2d, 0xf1, 0xeb, 0x48, 0x15, 0x87, 0x51, 0x40, 0x08, 0x17, 0x03, 0x02, 0x82, 0x38,
+ 0xa7, 0x7d, 0x45, 0x1d, 0x28, 0x01, 0x8b, 0xca, 0xfb, 0x8a, 0x4c, 0x54, 0x80, 0x60, 0xe7, 0xb1,
+ 0xa6, 0xb0, 0x2a, 0x7d, 0xa8, 0x01, 0xa0, 0x52, 0xe2, 0x95, 0x45, 0x38, 0x8e, 0x28, 0x02, 0x20,
+ 0x3e, 0x6c, 0xd3, 0xe9, 0x00, 0xcd, 0x2e, 0x70, 0x28, 0x02, 0x3c, 0x65, 0x8d, 0x21, 0xc9, 0x3b,
+ 0x54, 0x64, 0xd4, 0xeb, 0x19, 0x6e, 0xa3, 0x02, 0x91, 0xdc, 0x27, 0xca, 0x83, 0x9a, 0x00, 0x8c,
+ 0x44, 0x17, 0xe6, 0x72, 0x29, 0xac, 0x7c, 0xce, 0x31, 0xf2, 0x8a, 0x76, 0xd2, 0xc7, 0x2d, 0xcd,
+ 0x28, 0xa0, 0x08, 0x82, 0xae, 0x76, 0xb0, 0x23, 0xd2, 0x91, 0x94, 0xa7, 0x41, 0xf8, 0xd4, 0xac,
+ 0xa3, 0x1c, 0xd3, 0x41, 0xc8, 0xc1, 0xa0, 0x06, 0x0f, 0xcc, 0xd0, 0x05, 0x39, 0x46, 0x0e, 0x05,
+ 0x2e, 0x38, 0xa0, 0x08, 0xcf, 0x5a, 0x29, 0xc6, 0x93, 0x8f, 0xc6, 0x80, 0x24, 0x14, 0xf1, 0xc0,
+ 0xcd, 0x46, 0x29, 0xfd, 0xa8, 0x10, 0x0a, 0x5c, 0x52, 0x0e, 0x29, 0x7b, 0xd0, 0x03, 0x97, 0xa1,
+ 0xa7, 0x62, 0x9a, 0xbf, 0x7a, 0x9f, 0x4c, 0x62, 0x63, 0xb5, 0x33, 0xa6, 0x6a, 0x4a, 0x63, 0x75,
+ 0x34, 0x84, 0x0a, 0x28, 0x1d, 0x78, 0xa0, 0x9d, 0xab, 0x9e, 0xe7, 0xa0, 0xa5, 0x03, 0x1d, 0x68,
+ 0x00, 0xc6, 0x4d, 0x2e, 0x3b, 0xd2, 0x13, 0x9f, 0xa5, 0x2f, 0xd2, 0x80, 0x1c, 0x09, 0xa5, 0xfe,
+ 0x74, 0xde, 0xb4, 0xbf, 0x5a, 0x00, 0x76, 0x68, 0xe0, 0xfa, 0x51, 0x49, 0xb7, 0xd6, 0x81, 0x8a,
+ 0x29, 0xa7, 0x39, 0xa7, 0x71, 0xd2, 0x93, 0x3c, 0xd0, 0x21, 0x28, 0xef, 0x4b, 0x4a, 0x02, 0x9a,
+ 0x00, 0x39, 0x14, 0x64, 0xe2, 0x8c, 0x00, 0x3a, 0xd0, 0x38, 0xa0, 0x61, 0xc7, 0x7a, 0x6b, 0x28,
+ 0x14, 0xee, 0x0f, 0x18, 0xe6, 0x9b, 0xed, 0x40, 0x84, 0xc7, 0x14, 0x63, 0x23, 0x0c, 0x29, 0x77,
+ 0x2a, 0x9c, 0x75, 0x3e, 0x82, 0x98, 0xca, 0xcc, 0x72, 0xc7, 0x1e, 0xc2, 0x80, 0x14, 0x65, 0x78,
+ 0xa0, 0x9f, 0x97, 0x03, 0xbd, 0x03, 0x8e, 0x31, 0xc5, 0x3b, 0x82, 0x39, 0xa0, 0x06, 0x8c, 0x20,
+ 0xe7, 0x8a, 0x40, 0xc8, 0x0e, 0x40, 0x63, 0xf5, 0xa7, 0x18, 0xcf, 0x51, 0xcd, 0x44, 0x5b, 0x23,
+ 0x6f, 0x7a, 0x00, 0x90, 0xb1, 0x61, 0x81, 0xc0, 0xf4, 0x14, 0xcc, 0x05, 0xed, 0x49, 0x9d, 0x80,
+ 0x01, 0xd3, 0xb9, 0xa7, 0x64, 0x11, 0xda, 0x90, 0x06, 0x45, 0x21, 0xc6, 0x28, 0xa5, 0xcd, 0x31,
+ 0x8c, 0xea, 0x69, 0x1a, 0x9f, 0x8e, 0xb4, 0xc2, 0x3b, 0x50, 0x21, 0xa3, 0x01, 0xb8, 0xa7, 0x9e,
+ 0x05, 0x30, 0x0e, 0x69, 0xe7, 0x93, 0xc9, 0xcd, 0x00, 0x33, 0x06, 0x93, 0x18, 0xa5, 0x39, 0xcd,
+ 0x26, 0x4d, 0x00, 0x3f, 0x02, 0x83, 0xc9, 0xa5, 0xa0, 0x62, 0x81, 0x8e, 0x14, 0x74, 0xa3, 0xb7,
+ 0x14, 0x86, 0x81, 0x00, 0x3c, 0xe6, 0x9e, 0x25, 0x0d, 0xc3, 0x0c, 0x1f, 0x5a, 0x60, 0xeb, 0x8a,
+ 0x42, 0x07, 0x7a, 0x00, 0x79, 0x3b, 0x5b, 0x04, 0x50, 0x79, 0x20, 0xe0, 0xd2, 0x21, 0xc8, 0xd8,
+ 0xdf, 0x81, 0xa6, 0xb1, 0x64, 0x25, 0x49, 0x34, 0x00, 0xec, 0xef, 0x93, 0x23, 0xa2, 0xf0, 0x29,
+ 0x49, 0xe6, 0x91, 0x40, 0x55, 0x0b, 0xdf, 0xd6, 0x97, 0x90, 0x7d, 0x28, 0x00, 0xcf, 0x63, 0x4a,
+ 0x48, 0xed, 0x49, 0x81, 0x9a, 0x50, 0x07, 0x61, 0x40, 0x0e, 0x0d, 0x9e, 0x3a, 0x52, 0x8f, 0x7e,
+ 0xd5, 0x1f, 0x20, 0xfb, 0x53, 0x81, 0xcf, 0x7a, 0x00, 0x7e, 0x7d, 0x28, 0xc1, 0x3d, 0xf3, 0x4a,
+ 0x17, 0x3d, 0x4f, 0x1e, 0xb4, 0x6f, 0xc7, 0x0a, 0x3f, 0x1a, 0x00, 0x38, 0x51, 0x4d, 0xcf, 0x34,
+ 0xbd, 0x4e, 0x4d, 0x21, 0xeb, 0x40, 0x0b, 0x8a, 0x38, 0x1f, 0x8d, 0x19, 0xcd, 0x07, 0x91, 0x48,
+ 0x03, 0xa1, 0xa5, 0xa4, 0x1f, 0x30, 0xf7, 0xa4, 0xc9, 0x1c, 0x50, 0x02, 0xe7, 0x07, 0x34, 0xd6,
+ 0xcb, 0x75, 0x38, 0xf6, 0x14, 0xa4, 0x64, 0x74, 0xcd, 0x30, 0xf1, 0xda, 0x98, 0x0e, 0x5e, 0x38,
+ 0x03, 0x14, 0x86, 0x95, 0x79, 0x14, 0xd2, 0x79, 0xe6, 0x90, 0x0a, 0x29, 0x47, 0xa5, 0x36, 0xa5,
+ 0x8e, 0x36, 0x95, 0xc2, 0xc6, 0x8c, 0xee, 0x7a, 0x05, 0x19, 0x34, 0xae, 0x92, 0xbb, 0x01, 0x8c,
+ 0xdb, 0x46, 0x33, 0xc9, 0xa6, 0x82, 0x33, 0xc8, 0xa9, 0xae, 0x2c, 0x6f, 0x2d, 0xc6, 0xe9, 0xad,
+ 0xa5, 0x8d, 0x7d, 0x59, 0x78, 0xa8, 0xa0, 0x89, 0xae, 0x2e, 0x62, 0x85, 0x7a, 0xbb, 0x05, 0xa9,
+ 0x55, 0x22, 0xd7, 0x32, 0x7a, 0x09, 0xb2, 0xea, 0x69, 0x57, 0x0d, 0xa6, 0xbe, 0xa3, 0x80, 0x2d,
+ 0xc1, 0xc0, 0x07, 0xa9, 0xaa, 0x5b, 0x10, 0x8d, 0xc1, 0x78, 0xf5, 0x15, 0xd9, 0x78, 0x96, 0xe1,
+ 0x6c, 0x34, 0x38, 0x34, 0xf8, 0x80, 0x50, 0xfc, 0x63, 0xd8, 0x77, 0xae, 0x29, 0x5d, 0xe3, 0x6c,
+ 0xa9, 0x20, 0x9f, 0x4a, 0xe6, 0xc2, 0xd6, 0x9d, 0x68, 0xb9, 0xbd, 0xaf, 0xa0, 0xd0, 0x18, 0xc6,
+ 0x7e, 0x56, 0xc7, 0xd6, 0x8d, 0x8c, 0xbe, 0xff, 0x00, 0x4a, 0x4e, 0x86, 0x8d, 0xe4, 0x77, 0xae,
+ 0xc1, 0x86, 0x71, 0xd7, 0xad, 0x35, 0xb0, 0x45, 0x3b, 0x78, 0x3d, 0x40, 0xc5, 0x04, 0x0c, 0x71,
+ 0x40, 0x0c, 0x5c, 0xfa, 0xe6, 0x94, 0xf1, 0xda, 0x9a, 0xbc, 0x36, 0x41, 0xfc, 0x29, 0x09, 0x7c,
+ 0xe7, 0x07, 0x14, 0x08, 0x75, 0x19, 0xa8, 0xcc, 0x98, 0xea, 0x08, 0xfc, 0x29, 0x3c, 0xc1, 0xeb,
+ 0x40, 0x5c, 0x98, 0xf4, 0xa1, 0x48, 0xc7, 0xbd, 0x23, 0x9e, 0x40, 0xa5, 0xe0, 0x7d, 0x69, 0x80,
+ 0xe1, 0xc5, 0x28, 0x1c, 0x53, 0x57, 0x9e, 0xf4, 0xfa, 0x00, 0x61, 0x18, 0x61, 0x49, 0x8a, 0x59,
+ 0x00, 0x50, 0x0e, 0x4e, 0x73, 0x4e, 0x03, 0x02, 0x80, 0x1b, 0x8c, 0xd3, 0x86, 0x24, 0x1b, 0x5b,
+ 0xef, 0x0e, 0x86, 0x93, 0xb5, 0x21, 0x1d, 0xe8, 0x01, 0x3a, 0xf0, 0x7a, 0xd3, 0xc6, 0x0a, 0x71,
+ 0xda, 0x90, 0x83, 0x20, 0xdc, 0xa0, 0x96, 0x1d, 0x46, 0x29, 0x22, 0x59, 0x5d, 0xbf, 0x73, 0x1b,
+ 0x3b, 0x9e, 0xca, 0x33, 0x52, 0xda, 0x5b, 0x88, 0x52, 0x73, 0x46, 0x0f, 0xbd, 0x3e, 0x53, 0x73,
+ 0x06, 0x04, 0xb0, 0xec, 0x63, 0xea, 0xb4, 0x22, 0xdd, 0x4c, 0xa4, 0xc7, 0x1b, 0x11, 0xea, 0xab,
+ 0x4b, 0x9e, 0x36, 0xbd, 0xc2, 0xe8, 0x40, 0xa4, 0x8e, 0x69, 0x41, 0xe7, 0x6e, 0x3e, 0x6a, 0x64,
+ 0x8a, 0xe1, 0xc2, 0xc8, 0xac, 0xa7, 0xdc, 0x62, 0x9c, 0xa7, 0x03, 0x03, 0xaf, 0x72, 0x69, 0xa6,
+ 0x9e, 0xc0, 0x3f, 0x2a, 0xdf, 0x2e, 0x7a, 0x54, 0xd6, 0xf6, 0xd3, 0xdd, 0xdc, 0x24, 0x16, 0xf1,
+ 0x19, 0x24, 0x73, 0x85, 0x55, 0xea, 0x6a, 0xb1, 0x20, 0x8c, 0x7e, 0xb5, 0xe9, 0x9f, 0x0c, 0x34,
+ 0x74, 0xda, 0xfa, 0x9c, 0xeb, 0xb9, 0x9c, 0xec, 0x8b, 0xd9, 0x47, 0x53, 0xf8, 0x9f, 0xe5, 0x51,
+ 0x52, 0xa7, 0x24, 0x6e, 0x34, 0x37, 0x4c, 0xf8, 0x53, 0x71, 0x71, 0x6e, 0x24, 0xbd, 0xbc, 0x31,
+ 0xb9, 0x19, 0xd9, 0x12, 0xe7, 0x1f, 0x89, 0xac, 0xad, 0x73, 0xe1, 0xde, 0xa3, 0xa5, 0xe6, 0x4b,
+ 0x59, 0x3e, 0xd4, 0x83, 0xf8, 0x76, 0xe1, 0xbf, 0xfa, 0xf5, 0xef, 0xd6, 0x8a, 0x9e, 0x58, 0x1c,
+ 0x74, 0xed, 0x54, 0xf5, 0x2b, 0x58, 0xd8, 0x1e, 0x05, 0x71, 0x7d, 0x62, 0xa2, 0xd6, 0xe5, 0x2b,
+ 0x3d, 0x0f, 0x97, 0x5d, 0x5d, 0x1c, 0xa3, 0xa9, 0x56, 0x53, 0x82, 0x08, 0xc1, 0x14, 0xdd, 0xdd,
+ 0xab, 0xdf, 0x2e, 0x74, 0xad, 0x08, 0xdc, 0x34, 0xda, 0x86, 0x99, 0x05, 0xc3, 0x01, 0x9d, 0xcc,
+ 0xa3, 0x35, 0xc1, 0xeb, 0x5e, 0x35, 0xb1, 0xd3, 0xae, 0xa5, 0xb4, 0xd2, 0xb4, 0x4d, 0x38, 0xa2,
+ 0xe5, 0x49, 0x78, 0x41, 0x1f, 0xfd, 0x73, 0x5a, 0xc3, 0x15, 0xce, 0xf9, 0x63, 0x11, 0xf2, 0xdb,
+ 0xa9, 0xe7, 0xfb, 0xb6, 0x9c, 0x8a, 0x7a, 0xc6, 0xd7, 0x0c, 0x16, 0x25, 0x2c, 0xe7, 0xa0, 0x03,
+ 0xad, 0x69, 0xea, 0xfa, 0xa2, 0x78, 0x82, 0xee, 0xdf, 0xec, 0x9a, 0x5c, 0x16, 0x92, 0x84, 0xda,
+ 0xeb, 0x07, 0x01, 0xcf, 0xa9, 0x18, 0xe2, 0xb6, 0xf4, 0x4d, 0x2a, 0x3d, 0x34, 0x6f, 0x3f, 0xbc,
+ 0x9d, 0xba, 0x9f, 0x4f, 0x61, 0xed, 0x51, 0x8a, 0xc7, 0x47, 0x0f, 0x0b, 0xb5, 0xef, 0x76, 0x20,
+ 0xcc, 0xb5, 0xf0, 0xae, 0xa1, 0x34, 0x5b, 0xa5, 0x64, 0x88, 0x9e, 0x8a, 0x72, 0x4f, 0xe9, 0x59,
+ 0x3a, 0x8e, 0x9f, 0x71, 0xa6, 0xcd, 0xe5, 0xdc, 0x2f, 0x07, 0xee, 0xb0, 0xe8, 0x6b, 0xd2, 0xe2,
+ 0x49, 0x98, 0x6e, 0x2f, 0xb3, 0x3f, 0xdd, 0xac, 0xaf, 0x12, 0xe9, 0x4c, 0xfa, 0x73, 0x97, 0x0c,
+ 0x48, 0x5d, 0xeb, 0x9f, 0xe7, 0x5e, 0x46, 0x1f, 0x38, 0xaa, 0xea, 0xaf, 0x69, 0x6e, 0x57, 0xf8,
+ 0x01, 0xe7, 0xca, 0x71, 0xcf, 0x6a, 0x18, 0xe0, 0x9a, 0x81, 0x24, 0xc3, 0x53, 0xdc, 0xfb, 0xd7,
+ 0xd2, 0x5c, 0x49, 0x92, 0xc6, 0xa6, 0x47, 0x54, 0x5f, 0xbc, 0xc4, 0x01, 0x5e, 0x8d, 0xa2, 0xe9,
+ 0x71, 0x5a, 0x44, 0x8a, 0x88, 0x37, 0x63, 0xe6, 0x62, 0x39, 0x35, 0xc7, 0xf8, 0x66, 0xcc, 0xcf,
+ 0x7c, 0xb3, 0x32, 0xfc, 0xa9, 0xf7, 0x7e, 0xb5, 0xe8, 0x71, 0xb0, 0x8b, 0x00, 0x57, 0xce, 0x67,
+ 0x38, 0x97, 0x29, 0x2a, 0x31, 0x7a, 0x2d, 0xc6, 0x8b, 0xa9, 0xa5, 0x2d, 0xf4, 0x4d, 0x1a, 0x15,
+ 0x67, 0xc7, 0xdc, 0x3d, 0xc5, 0x72, 0x6f, 0xe0, 0xc9, 0x34, 0xcd, 0x64, 0x5c, 0xef, 0xfd, 0xda,
+ 0xb1, 0x3e, 0x5e, 0x3a, 0x1f, 0xaf, 0xa5, 0x75, 0x09, 0x73, 0xe5, 0xb6, 0x55, 0xb6, 0x91, 0xdc,
+ 0x54, 0xb7, 0xba, 0xc2, 0xc9, 0x6a, 0x10, 0xa2, 0x0c, 0x77, 0x03, 0x9c, 0xfd, 0x6b, 0xc8, 0xa3,
+ 0x5e, 0x74, 0x53, 0x50, 0x76, 0xb9, 0x6d, 0x26, 0x8f, 0x31, 0xf1, 0x84, 0xc5, 0xaf, 0xe0, 0x85,
+ 0x49, 0x01, 0x14, 0x9c, 0x9a, 0xc1, 0x55, 0xe7, 0xef, 0xf1, 0x5e, 0x85, 0xab, 0x5b, 0x5a, 0xea,
+ 0x76, 0xec, 0x27, 0x40, 0x71, 0xca, 0x91, 0xd4, 0x7d, 0x0d, 0x71, 0x37, 0x9a, 0x64, 0xf6, 0x32,
+ 0x1d, 0xc8, 0xc6, 0x13, 0xca, 0xc9, 0x8e, 0x08, 0xaf, 0xa4, 0xca, 0xf1, 0x94, 0xe7, 0x4d, 0x53,
+ 0x7a, 0x35, 0xf8, 0x91, 0x6b, 0x15, 0x70, 0x83, 0xa9, 0x26, 0x8e, 0x3a, 0xed, 0xfc, 0xe9, 0xa5,
+ 0x82, 0xf4, 0xe4, 0xd2, 0x7c, 0xcd, 0xf7, 0xdb, 0x03, 0xd0, 0x57, 0xaf, 0x71, 0x8e, 0x2e, 0xb9,
+ 0xc0, 0x19, 0x3e, 0xd4, 0x9b, 0xb0, 0x3a, 0x11, 0x48, 0x4e, 0x3a, 0x70, 0x2a, 0x7b, 0x3b, 0x49,
+ 0xaf, 0x65, 0xf2, 0xe2, 0x1d, 0x39, 0x2c, 0x7a, 0x01, 0x4a, 0x52, 0x51, 0x57, 0x60, 0xca, 0xa3,
+ 0xef, 0x12, 0x05, 0x3f, 0x76, 0x2b, 0xa5, 0xb3, 0xb0, 0xd3, 0xad, 0xa7, 0x54, 0x74, 0x37, 0x12,
+ 0xff, 0x00, 0x11, 0x3d, 0x07, 0xe1, 0x56, 0x35, 0x3b, 0x5d, 0x3a, 0xe1, 0x7f, 0x73, 0x14, 0x71,
+ 0xe0, 0x72, 0xe3, 0x8c, 0x7b, 0x7b, 0x9a, 0xe2, 0xfe, 0xd0, 0x83, 0x97, 0x2a, 0x4c, 0x49, 0xdf,
+ 0x63, 0x92, 0xdf, 0x41, 0x08, 0xc3, 0x95, 0x14, 0xe9, 0xd0, 0x45, 0x31, 0x4e, 0x08, 0x1d, 0x08,
+ 0xee, 0x29, 0x83, 0x69, 0xe8, 0x71, 0x5d, 0xc9, 0xa6, 0xae, 0x86, 0x3c, 0xc6, 0x03, 0x12, 0x09,
+ 0xa3, 0x6d, 0x3c, 0x9e, 0x7f, 0x0a, 0x43, 0x54, 0x02, 0x11, 0x8a, 0x51, 0xf3, 0x8e, 0xbc, 0xd3,
+ 0x71, 0x4e, 0x18, 0xeb, 0x40, 0x0c, 0x97, 0xef, 0xe3, 0x39, 0xc0, 0xa5, 0x53, 0x95, 0x06, 0x98,
+ 0x39, 0x62, 0x7d, 0x6a, 0xcd, 0x94, 0x46, 0x5b, 0x80, 0xb8, 0xc8, 0x07, 0x35, 0x13, 0x9a, 0x84,
+ 0x5c, 0x9f, 0x42, 0x5b, 0xb6, 0xa5, 0xcb, 0x3d, 0x29, 0xee, 0x8a, 0xb3, 0x12, 0xaa, 0x7a, 0x00,
+ 0x39, 0x35, 0xb3, 0x1f, 0x87, 0xed, 0xb6, 0xed, 0x78, 0x58, 0xfb, 0xef, 0xc9, 0xab, 0x76, 0xea,
+ 0x2d, 0xd0, 0x0c, 0x8d, 0xc6, 0xae, 0x41, 0x75, 0xe4, 0x4e, 0xb2, 0x06, 0xc3, 0x0e, 0x41, 0xf7,
+ 0xaf, 0x9c, 0xad, 0x8d, 0xaf, 0x52, 0x57, 0x4e, 0xcb, 0xc8, 0xcb, 0x9e, 0xec, 0xad, 0x69, 0x6d,
+ 0x15, 0xa9, 0x11, 0x98, 0x70, 0x9e, 0xa0, 0x74, 0xfa, 0xd5, 0x95, 0xb7, 0x8d, 0x26, 0x2d, 0x04,
+ 0x60, 0xa3, 0x75, 0xd8, 0xbc, 0x66, 0x96, 0xe2, 0xe7, 0x72, 0xfc, 0xd8, 0x69, 0xa4, 0x39, 0x27,
+ 0xd0, 0x53, 0xed, 0xde, 0x64, 0x3f, 0x2f, 0x20, 0x7a, 0x57, 0x9d, 0x51, 0xca, 0xec, 0xa5, 0x24,
+ 0x47, 0xa8, 0x58, 0x5b, 0xde, 0x5b, 0x6c, 0x75, 0xc6, 0x7b, 0x11, 0x83, 0xf8, 0x55, 0xe5, 0xd3,
+ 0xd2, 0xde, 0xc1, 0x1e, 0x38, 0xd3, 0xca, 0x1f, 0x2f, 0x1d, 0xaa, 0xd2, 0x47, 0xf6, 0x98, 0xc6,
+ 0xe1, 0xcf, 0xd2, 0xa8, 0xcd, 0x1c, 0xb0, 0xb4, 0x8a, 0xa5, 0x8a, 0x9c, 0x0c, 0x67, 0x8c, 0x7b,
+ 0xd4, 0x46, 0x77, 0x5c, 0xad, 0x97, 0xcb, 0xd4, 0xc5, 0xd4, 0x2d, 0x23, 0xbc, 0x56, 0x1b, 0x01,
+ 0xc7, 0x7f, 0x4a, 0xe5, 0x25, 0xb1, 0xb9, 0x86, 0x7f, 0x2d, 0x63, 0x67, 0x1d, 0x8a, 0x8c, 0xd7,
+ 0x76, 0xf6, 0xd3, 0x2c, 0x6c, 0xc2, 0x33, 0xb3, 0xa9, 0xc1, 0xaa, 0x0e, 0x07, 0x2a, 0x63, 0x02,
+ 0xbd, 0x1c, 0x26, 0x2e, 0x74, 0x74, 0x8e, 0xa8, 0xcd, 0xbe, 0x53, 0x93, 0x6b, 0x3b, 0xa5, 0x2a,
+ 0xa6, 0x06, 0xcb, 0x1c, 0x01, 0x5e, 0xbf, 0xe1, 0x99, 0xe3, 0xb0, 0xd2, 0xed, 0xa0, 0x46, 0xfb,
+ 0xa8, 0x3a, 0x7a, 0xd7, 0x9e, 0xde, 0x39, 0x86, 0x02, 0x3a, 0xd5, 0x5d, 0x33, 0xc5, 0x52, 0x58,
+ 0x4a, 0x21, 0x93, 0x79, 0x54, 0x18, 0xce, 0x6b, 0xd1, 0x55, 0xe7, 0x5d, 0x59, 0xa1, 0xc2, 0x77,
+ 0x76, 0x67, 0xbf, 0x5a, 0x6a, 0x83, 0x00, 0x67, 0x1f, 0xce, 0xac, 0x5c, 0x6a, 0x31, 0x94, 0xe4,
+ 0xf2, 0x7d, 0xf3, 0x5e, 0x55, 0xa6, 0x78, 0xaa, 0x3b, 0x95, 0x05, 0x65, 0x51, 0x9e, 0xd5, 0xb8,
+ 0x9a, 0xc6, 0xe1, 0xcb, 0x11, 0xef, 0xfe, 0x15, 0x12, 0xd3, 0x73, 0xa9, 0x47, 0x4b, 0x9b, 0x1a,
+ 0x9b, 0x09, 0x15, 0x80, 0xee, 0x2b, 0xc4, 0x21, 0xd2, 0xee, 0x6e, 0xee, 0xe6, 0x04, 0x85, 0x89,
+ 0x24, 0x60, 0xd2, 0x37, 0xd7, 0xb7, 0xad, 0x7a, 0x85, 0xd6, 0xae, 0x82, 0x07, 0x7c, 0x8c, 0x01,
+ 0xc0, 0xcf, 0x24, 0xd7, 0x3f, 0x6b, 0xa7, 0x8d, 0x81, 0xa4, 0xf9, 0xdc, 0xf3, 0x8e, 0xc2, 0xb9,
+ 0x6a, 0x63, 0x7e, 0xaf, 0x7e, 0x5d, 0xd9, 0x9c, 0xb5, 0x65, 0x4d, 0x3f, 0x4f, 0x86, 0xce, 0x20,
+ 0x62, 0x43, 0x96, 0xea, 0xcd, 0xd5, 0xab, 0x6e, 0xd2, 0x1e, 0x32, 0x7f, 0x13, 0x4a, 0x2d, 0x70,
+ 0x01, 0x6f, 0xc0, 0x55, 0xa8, 0x95, 0x56, 0x30, 0x09, 0x15, 0xe3, 0xce, 0x72, 0xab, 0x2e, 0x69,
+ 0x13, 0x61, 0x5e, 0x60, 0x80, 0x52, 0x5c, 0x4e, 0x6f, 0x2c, 0x9a, 0x03, 0xdb, 0x95, 0xcf, 0x6a,
+ 0x6b, 0x2a, 0x60, 0x92, 0x73, 0x59, 0xf7, 0x37, 0x82, 0x2e, 0x10, 0xd6, 0x71, 0x4c, 0x6f, 0x43,
+ 0x9f, 0xf1, 0x35, 0xbd, 0xa8, 0xb5, 0x69, 0x96, 0xc3, 0x65, 0xc0, 0xc0, 0x32, 0x29, 0xc0, 0xc6,
+ 0x79, 0xe2, 0xb9, 0x68, 0x63, 0xfb, 0x45, 0xc4, 0x71, 0x67, 0x1b, 0x8e, 0x33, 0x5d, 0xc4, 0xd7,
+ 0x91, 0x5c, 0x42, 0xd0, 0xca, 0x01, 0x56, 0x18, 0x39, 0xae, 0x7f, 0x4c, 0xb1, 0x8a, 0xdb, 0x53,
+ 0x95, 0xde, 0x40, 0xd1, 0xa7, 0x11, 0x9f, 0x5c, 0xd7, 0xbd, 0x83, 0xc6, 0xb8, 0x50, 0x94, 0x65,
+ 0xba, 0xd8, 0xcd, 0xb3, 0xa6, 0xd1, 0xa0, 0x4b, 0x75, 0x1b, 0x53, 0x0a, 0xa3, 0x00, 0x7a, 0x55,
+ 0xdb, 0xe7, 0x28, 0x9f, 0x68, 0x59, 0x18, 0x3a, 0x0c, 0x8c, 0x9e, 0x08, 0xee, 0x28, 0xb3, 0x92,
+ 0x1f, 0x27, 0xf7, 0x6e, 0xad, 0xfd, 0xe2, 0x0f, 0x4a, 0xcb, 0xd5, 0xaf, 0x96, 0x47, 0x16, 0xb0,
+ 0x36, 0x5d, 0xfa, 0x91, 0xd0, 0x0a, 0xf3, 0x23, 0xcf, 0x29, 0xdd, 0xfc, 0xca, 0xbd, 0x91, 0x74,
+ 0xde, 0x99, 0x11, 0x58, 0x1c, 0x06, 0x00, 0xd4, 0x0f, 0x75, 0x93, 0x82, 0x78, 0xaa, 0x8f, 0x32,
+ 0x84, 0x0a, 0xbc, 0x00, 0x30, 0x2a, 0x9c, 0xb3, 0xf6, 0x07, 0xad, 0x67, 0x1a, 0x57, 0x65, 0xad,
+ 0x74, 0x2e, 0xc9, 0x70, 0xd2, 0xb8, 0x8d, 0x0f, 0x5e, 0xf5, 0x66, 0x77, 0x5f, 0xb2, 0x18, 0x64,
+ 0xc3, 0x2e, 0xdc, 0x10, 0x6b, 0x2e, 0x09, 0x0c, 0x39, 0x63, 0xd4, 0xd5, 0x7b, 0xfd, 0x4b, 0xca,
+ 0x81, 0x9b, 0x77, 0x27, 0x81, 0xee, 0x6b, 0x48, 0xd1, 0x94, 0xa4, 0xa3, 0x03, 0x55, 0x1b, 0xea,
+ 0x62, 0x5d, 0x41, 0xf6, 0x59, 0x8a, 0x65, 0x48, 0xfe, 0x16, 0x52, 0x08, 0x23, 0xeb, 0x55, 0xc9,
+ 0xa9, 0xd8, 0x66, 0xc2, 0x39, 0x4f, 0x53, 0x23, 0x02, 0x6a, 0x0e, 0x5b, 0x00, 0x72, 0x7d, 0x05,
+ 0x7d, 0x7c, 0x24, 0xf9, 0x75, 0x33, 0xb0, 0xf8, 0x21, 0x7b, 0x99, 0x96, 0x28, 0xc6, 0x59, 0x8f,
+ 0xe5, 0x5d, 0x3a, 0x45, 0x16, 0x9f, 0x67, 0xe5, 0xa1, 0xc7, 0x19, 0x66, 0xee, 0xc6, 0xab, 0x68,
+ 0xd6, 0x4d, 0x0c, 0x46, 0x56, 0x43, 0xe6, 0x30, 0xe9, 0x8e, 0x40, 0xa5, 0xbe, 0xb5, 0xd4, 0x2f,
+ 0x55, 0x96, 0x18, 0x4a, 0xae, 0x70, 0x4b, 0x7c, 0xb5, 0xe4, 0xe2, 0xf1, 0x0a, 0xa4, 0xfd, 0x9d,
+ 0xed, 0x10, 0x85, 0x29, 0xd5, 0x95, 0xa2, 0x9b, 0x32, 0x27, 0xd4, 0x9f, 0xed, 0x5b, 0xa3, 0x39,
+ 0x51, 0xc7, 0x3d, 0xe9, 0xc9, 0xaa, 0x3a, 0x44, 0x15, 0x53, 0x91, 0x9e, 0x73, 0xeb, 0x57, 0xac,
+ 0xbc, 0x23, 0x79, 0x70, 0xf9, 0x96, 0x54, 0x44, 0xff, 0x00, 0x67, 0x92, 0x6a, 0xed, 0xcf, 0x83,
+ 0x96, 0x28, 0x89, 0x8e, 0xe1, 0xc3, 0xe3, 0x8d, 0xe0, 0x60, 0xd3, 0xfa, 0xd6, 0x02, 0x12, 0x51,
+ 0xe6, 0xfc, 0xce, 0xf8, 0xe5, 0xd8, 0xa7, 0x1e, 0x65, 0x1f, 0xc8, 0xe5, 0x64, 0x90, 0xc8, 0xe5,
+ 0xdb, 0xa9, 0xa6, 0xe3, 0x9e, 0x2a, 0x4b, 0x88, 0x25, 0xb5, 0x99, 0xa1, 0x95, 0x76, 0xb2, 0xd4,
+ 0x60, 0xd7, 0xb1, 0x16, 0x9a, 0x4e, 0x3b, 0x1e, 0x7c, 0xa2, 0xe2, 0xec, 0xf7, 0x2c, 0x13, 0xc8,
+ 0xa5, 0xa4, 0x6e, 0x80, 0xd1, 0x5a, 0x00, 0x52, 0x3b, 0x61, 0x3e, 0xb4, 0xbd, 0xe9, 0x8e, 0x72,
+ 0xc0, 0x7a, 0x52, 0x10, 0xd1, 0xc3, 0x0a, 0xd7, 0xd1, 0x80, 0x13, 0x16, 0x3d, 0x8d, 0x64, 0x8e,
+ 0x5b, 0x8e, 0xc3, 0x9a, 0xdb, 0xd0, 0x63, 0x12, 0x17, 0x3d, 0xab, 0x8b, 0x1e, 0xed, 0x41, 0x91,
+ 0x3d, 0x8d, 0x67, 0x9b, 0x0d, 0x93, 0xde, 0x9e, 0xae, 0x1d, 0x87, 0x3c, 0x54, 0x52, 0x42, 0x4b,
+ 0x71, 0x50, 0x91, 0x24, 0x20, 0xb8, 0x1d, 0x2b, 0xc1, 0x51, 0xba, 0x30, 0x2f, 0xc1, 0xfb, 0xc9,
+ 0x8b, 0x67, 0x80, 0x70, 0x2b, 0x7f, 0x4d, 0xd4, 0x24, 0xb1, 0x85, 0x84, 0x65, 0x17, 0x7f, 0x52,
+ 0x54, 0x13, 0x8a, 0xe6, 0x2d, 0x26, 0xc4, 0x43, 0x9e, 0xf9, 0x34, 0x4f, 0xa8, 0x79, 0x71, 0xb1,
+ 0x27, 0x85, 0xac, 0xda, 0x77, 0xb2, 0xdc, 0xd2, 0x9a, 0x6d, 0xd9, 0x6e, 0x75, 0x97, 0x5e, 0x22,
+ 0x63, 0x18, 0x12, 0x4c, 0x91, 0xa6, 0x7b, 0x60, 0x56, 0x77, 0xf6, 0xbd, 0xb3, 0x2b, 0x36, 0xec,
+ 0xaf, 0xf7, 0xb0, 0x71, 0xf9, 0xd7, 0x2d, 0x04, 0x92, 0xc9, 0x20, 0x9e, 0x43, 0x96, 0x3f, 0x74,
+ 0x75, 0xdb, 0x5a, 0x33, 0xdd, 0xa8, 0xd3, 0xc4, 0x05, 0x63, 0x0e, 0x38, 0xc8, 0x18, 0x62, 0x3d,
+ 0xeb, 0xaa, 0x38, 0x08, 0xef, 0x37, 0xa9, 0xee, 0x47, 0x2d, 0x5c, 0xbe, 0xfc, 0xb5, 0x37, 0x17,
+ 0x5e, 0x4f, 0xb2, 0x32, 0x08, 0x86, 0x48, 0xc7, 0xb5, 0x73, 0xf7, 0x37, 0x39, 0x9b, 0x23, 0x8c,
+ 0xd6, 0x7a, 0xce, 0x62, 0x4e, 0xbf, 0x2f, 0x41, 0xed, 0x51, 0x49, 0x31, 0x69, 0x7a, 0xd6, 0x9e,
+ 0xc1, 0x43, 0x43, 0xc8, 0xc5, 0xe1, 0xea, 0x50, 0x95, 0xa5, 0xaa, 0xe8, 0xc7, 0x5f, 0xcb, 0xba,
+ 0x13, 0x8f, 0x4a, 0xe6, 0x1b, 0x33, 0x5d, 0x8d, 0xbc, 0x0c, 0x72, 0x6b, 0x66, 0xee, 0x61, 0xe5,
+ 0x91, 0x9e, 0x95, 0x8d, 0x6f, 0xd4, 0x9f, 0x53, 0x5d, 0x34, 0x17, 0x2d, 0xda, 0x27, 0x0b, 0x47,
+ 0xda, 0xd4, 0x49, 0xec, 0x74, 0xba, 0x4d, 0xa4, 0x7f, 0x2b, 0x22, 0xe5, 0x8f, 0x51, 0x9e, 0x4f,
+ 0xff, 0x00, 0x5e, 0xb7, 0x9e, 0x48, 0xe1, 0x82, 0x49, 0x62, 0x69, 0x18, 0x28, 0xfb, 0xae, 0xc7,
+ 0x8f, 0xa8, 0xeb, 0xf9, 0xd7, 0x27, 0x05, 0xeb, 0x42, 0xaa, 0x83, 0x03, 0xd4, 0xd4, 0xc9, 0x7f,
+ 0x34, 0x93, 0xb1, 0x08, 0xce, 0x64, 0xe1, 0x80, 0x07, 0xe6, 0xa9, 0xaf, 0x4d, 0xcb, 0x5b, 0x9e,
+ 0xde, 0x2b, 0x0a, 0xa7, 0x0b, 0xc1, 0x59, 0xa3, 0x63, 0x4f, 0xbd, 0x96, 0xf9, 0x95, 0xde, 0x32,
+ 0xd1, 0x87, 0xe3, 0x9e, 0x9e, 0xff, 0x00, 0x4a, 0xea, 0x11, 0x5c, 0x47, 0xbf, 0xcc, 0xf2, 0x82,
+ 0x8c, 0x83, 0x8c, 0xe6, 0xb2, 0xb4, 0xbb, 0x41, 0x69, 0x6d, 0xb9, 0xd7, 0x05, 0x46, 0x76, 0xfa,
+ 0xb7, 0xa7, 0xe1, 0x56, 0x2e, 0xaf, 0x84, 0x76, 0xe4, 0xb9, 0xfb, 0xa3, 0x2c, 0x3d, 0xcd, 0x78,
+ 0xf5, 0xda, 0x9b, 0xba, 0x47, 0x2e, 0x0e, 0x9d, 0x35, 0x2b, 0x54, 0xd4, 0xb3, 0x6d, 0xad, 0x5b,
+ 0xc9, 0x3b, 0x5a, 0xcb, 0xf2, 0x5c, 0x2a, 0xee, 0x1e, 0x8e, 0x3d, 0xbf, 0xc2, 0xa1, 0xba, 0xd4,
+ 0xd2, 0x22, 0x70, 0x78, 0xae, 0x52, 0xee, 0xef, 0x2d, 0x6e, 0xe9, 0xcc, 0x8b, 0x36, 0xfd, 0xff,
+ 0x00, 0x51, 0x82, 0x3e, 0x98, 0xfe, 0x55, 0x15, 0xc5, 0xfc, 0x67, 0x99, 0x18, 0xbb, 0x7a, 0x0a,
+ 0xd6, 0x38, 0x3e, 0x6b, 0x3d, 0x8e, 0x0a, 0xf5, 0x22, 0xa6, 0xfd, 0x9e, 0xdd, 0x0d, 0xe9, 0x35,
+ 0xbc, 0xf0, 0x99, 0x63, 0xe8, 0x2a, 0x94, 0xb7, 0x53, 0xce, 0x4e, 0x4a, 0xa0, 0xf4, 0x1c, 0xd7,
+ 0x3f, 0x2e, 0xae, 0x50, 0x6d, 0x8d, 0x42, 0xfa, 0x01, 0x5a, 0x36, 0x9a, 0x7d, 0xed, 0xe2, 0x09,
+ 0x26, 0x66, 0x5c, 0xff, 0x00, 0x08, 0xed, 0xf5, 0xae, 0x85, 0x85, 0xa5, 0x49, 0x5d, 0xa3, 0x96,
+ 0x52, 0x9b, 0xdc, 0x9d, 0xe5, 0x85, 0x17, 0x32, 0x30, 0x23, 0xde, 0x88, 0xb5, 0x54, 0x8a, 0x45,
+ 0x68, 0x63, 0x24, 0xa9, 0xc8, 0xf9, 0x78, 0xab, 0x0b, 0xa3, 0x73, 0xca, 0x80, 0x3e, 0x95, 0x2f,
+ 0xf6, 0x5a, 0x21, 0x1d, 0xfd, 0x72, 0x6a, 0xf9, 0xe3, 0x6d, 0x08, 0xd4, 0xce, 0x7b, 0xab, 0xa9,
+ 0xe4, 0xdb, 0x1a, 0x2c, 0x6b, 0x9e, 0x5d, 0xbf, 0xc2, 0xac, 0xc0, 0x91, 0x5b, 0xa1, 0x55, 0xdc,
+ 0xcc, 0x79, 0x67, 0x6e, 0xa7, 0xff, 0x00, 0xad, 0x57, 0x85, 0x8c, 0x21, 0x09, 0xde, 0x01, 0xf5,
+ 0xaa, 0xd2, 0x46, 0xa0, 0x10, 0x32, 0x7d, 0xc5, 0x65, 0x51, 0xa9, 0xab, 0x16, 0xa6, 0xd1, 0x56,
+ 0x79, 0x8a, 0x03, 0x83, 0x54, 0xbe, 0xd5, 0xb5, 0xb7, 0x37, 0xe1, 0x57, 0x5e, 0x22, 0x41, 0x0c,
+ 0x54, 0x8f, 0x43, 0x54, 0xa7, 0xb1, 0x69, 0x07, 0xee, 0xc8, 0x1e, 0xa0, 0x9a, 0x50, 0x84, 0x56,
+ 0x8c, 0xda, 0x15, 0x10, 0xb1, 0x4f, 0x71, 0x7f, 0x30, 0x8a, 0x11, 0xcf, 0xaf, 0x61, 0x5a, 0xb1,
+ 0x78, 0x53, 0xed, 0x52, 0x2b, 0x5c, 0xdd, 0x31, 0x03, 0xf8, 0x10, 0x60, 0x7e, 0x75, 0x77, 0xc2,
+ 0xfa, 0x0c, 0x81, 0x3c, 0xd9, 0xfe, 0x44, 0x63, 0xd4, 0x75, 0x22, 0xaf, 0x6b, 0x37, 0x12, 0xe9,
+ 0x13, 0xed, 0x88, 0xee, 0x8d, 0xd7, 0x28, 0x71, 0x58, 0xfb, 0x4a, 0x92, 0xaa, 0xe1, 0x41, 0xa5,
+ 0x63, 0xe8, 0xa8, 0x51, 0xa3, 0x4a, 0x82, 0xab, 0x5a, 0x2d, 0xdc, 0xad, 0x1e, 0x93, 0x6b, 0x05,
+ 0xc8, 0xb5, 0x8e, 0x35, 0x28, 0x89, 0xb8, 0x82, 0x33, 0x82, 0x6a, 0xfd, 0xb6, 0x8f, 0x68, 0x92,
+ 0x79, 0x8b, 0x04, 0x61, 0xfd, 0x42, 0xf3, 0x4d, 0xb2, 0x87, 0xc8, 0x84, 0x19, 0x1f, 0x74, 0xaf,
+ 0xf3, 0x3b, 0x7b, 0xfa, 0x7e, 0x15, 0x79, 0x26, 0x1d, 0xab, 0x8a, 0xbd, 0x59, 0xca, 0x4e, 0xd2,
+ 0x76, 0xdb, 0xd4, 0xf5, 0xb0, 0xf4, 0xa3, 0x18, 0x5d, 0xc5, 0x26, 0xf5, 0xf4, 0x27, 0x86, 0xca,
+ 0x1d, 0xdf, 0xc2, 0xbf, 0x85, 0x3e, 0x6b, 0x44, 0x0a, 0x7d, 0x2a, 0x15, 0x98, 0x77, 0x34, 0xe9,
+ 0x25, 0x26, 0x32, 0x09, 0xae, 0x74, 0x93, 0x3a, 0x35, 0xbe, 0xe6, 0x77, 0x98, 0x6d, 0xe6, 0xf9,
+ 0x4f, 0xcb, 0x9e, 0x95, 0x6a, 0xea, 0x74, 0x9e, 0x20, 0x40, 0xed, 0x59, 0xf7, 0x07, 0x92, 0x6a,
+ 0x18, 0xe7, 0xc1, 0x2a, 0x4d, 0x52, 0x8d, 0xd0, 0xcc, 0x7f, 0x10, 0x58, 0x0b, 0x98, 0x4c, 0xa8,
+ 0x3f, 0x7b, 0x1f, 0x23, 0xdc, 0x7a, 0x57, 0x22, 0x0e, 0x2b, 0xbe, 0x9d, 0xb3, 0x9a, 0xe2, 0x35,
+ 0x08, 0x84, 0x17, 0xb2, 0x28, 0x1c, 0x13, 0x91, 0xf4, 0x35, 0xf4, 0x99, 0x45, 0x76, 0xe2, 0xe9,
+ 0x4b, 0xa6, 0xc7, 0xce, 0xe6, 0xf4, 0x12, 0x92, 0xaa, 0xba, 0xee, 0x29, 0xe5, 0x05, 0x28, 0xa6,
+ 0xaf, 0xdd, 0x22, 0x94, 0x74, 0xaf, 0x74, 0xf1, 0x85, 0x15, 0x1e, 0xec, 0xe4, 0xd4, 0x84, 0x7c,
+ 0xbc, 0x8a, 0x6e, 0xdc, 0x90, 0xbf, 0x9d, 0x02, 0x00, 0xb8, 0x88, 0xb1, 0xea, 0x6b, 0x6b, 0x41,
+ 0x7d, 0x88, 0xff, 0x00, 0x5a, 0xc6, 0x90, 0xfc, 0x9f, 0x8d, 0x68, 0xe8, 0xf2, 0x6d, 0x67, 0x15,
+ 0xc1, 0x98, 0xab, 0xd0, 0x64, 0xc9, 0x1d, 0x18, 0x91, 0x45, 0x57, 0xb9, 0xb9, 0x53, 0x19, 0x41,
+ 0x8e, 0x69, 0x9e, 0x60, 0xfd, 0x2b, 0x3e, 0x62, 0x4c, 0x87, 0x19, 0xcd, 0x78, 0x51, 0x6d, 0xe8,
+ 0x67, 0xc8, 0xdb, 0xb2, 0x45, 0x94, 0x7d, 0x88, 0xdf, 0xa5, 0x56, 0x7d, 0xd7, 0x0c, 0x07, 0xf0,
+ 0x03, 0xf3, 0x1a, 0x95, 0x51, 0x88, 0xda, 0xf9, 0xe7, 0xa2, 0x8e, 0xa7, 0xfc, 0x29, 0xd2, 0xc4,
+ 0xf0, 0xc6, 0x0f, 0xc8, 0xa7, 0x38, 0xdb, 0x9e, 0x45, 0x76, 0xd2, 0xa1, 0xca, 0xf9, 0xa4, 0x7b,
+ 0x38, 0x2c, 0x0b, 0xa6, 0xd5, 0x4a, 0xbb, 0xf4, 0x43, 0xbe, 0xe9, 0xc0, 0x04, 0x15, 0xc7, 0x18,
+ 0xa6, 0xdc, 0x3f, 0x9e, 0xc1, 0x46, 0x40, 0x51, 0x82, 0x4d, 0x06, 0xf4, 0xef, 0x2d, 0xb4, 0x06,
+ 0x3c, 0x1e, 0x2a, 0xa5, 0xcd, 0xd2, 0xed, 0xc2, 0xfe, 0x39, 0xeb, 0x5d, 0x4b, 0xbb, 0x3d, 0x36,
+ 0xc2, 0x77, 0x54, 0x24, 0x03, 0xc6, 0x3a, 0x55, 0x3d, 0xf2, 0x30, 0x1b, 0x51, 0x98, 0xf4, 0xe0,
+ 0x54, 0x12, 0x4e, 0x64, 0x7d, 0xa3, 0x92, 0xc7, 0x15, 0xd4, 0xe9, 0x76, 0x68, 0x20, 0x4f, 0x30,
+ 0x9d, 0xa0, 0x70, 0x17, 0xbd, 0x67, 0x55, 0xe9, 0xa8, 0x4f, 0x06, 0xb1, 0x50, 0xe4, 0x6e, 0xd6,
+ 0x39, 0xa7, 0xb1, 0xbd, 0x9d, 0x08, 0x58, 0x48, 0x27, 0xd4, 0xe2, 0xae, 0x59, 0x78, 0x6a, 0xe1,
+ 0x54, 0x3c, 0xe4, 0x81, 0xfe, 0xc2, 0xe7, 0xf5, 0xae, 0xf6, 0xc3, 0x4f, 0x8e, 0xe4, 0x7e, 0xec,
+ 0x41, 0x1e, 0x3b, 0x3f, 0x53, 0xef, 0x4b, 0x73, 0xe7, 0x59, 0xa8, 0x62, 0x83, 0x6f, 0x45, 0x38,
+ 0xc0, 0x35, 0x2a, 0xa5, 0x95, 0xae, 0x69, 0x87, 0xcb, 0x28, 0x50, 0x7a, 0x5d, 0xbf, 0x33, 0x95,
+ 0x86, 0xc2, 0xda, 0xd3, 0x9f, 0xb3, 0xab, 0xbf, 0x66, 0x93, 0x9f, 0xd2, 0xb6, 0x2c, 0xa2, 0x94,
+ 0x7c, 0xf2, 0x60, 0x02, 0x3a, 0x00, 0x3e, 0x51, 0xf4, 0xf5, 0xab, 0xb6, 0xb6, 0x32, 0xea, 0x67,
+ 0xe4, 0xb6, 0xc8, 0x19, 0x6e, 0x17, 0xae, 0x3f, 0xa5, 0x6b, 0xb5, 0x94, 0x17, 0x2f, 0x1d, 0xad,
+ 0xa0, 0x71, 0x1a, 0x60, 0xca, 0xee, 0x39, 0x27, 0x03, 0xff, 0x00, 0xaf, 0x5e, 0x6e, 0x33, 0x16,
+ 0xa0, 0x9a, 0xb9, 0x8e, 0x3a, 0xa7, 0x37, 0xee, 0x28, 0xaf, 0x5f, 0xf2, 0x32, 0xa2, 0xb7, 0x9e,
+ 0xf7, 0x10, 0xc1, 0x13, 0x33, 0x6e, 0xf5, 0xc0, 0x03, 0xde, 0xad, 0x37, 0x81, 0x4d, 0xea, 0x11,
+ 0x75, 0x78, 0x54, 0x13, 0x90, 0xb1, 0x0e, 0x9f, 0x89, 0xae, 0xb2, 0xc6, 0xc1, 0x61, 0x8d, 0x62,
+ 0x86, 0x3f, 0xcb, 0xbd, 0x6c, 0xdb, 0xe9, 0xd2, 0x36, 0x32, 0x84, 0x7d, 0x6b, 0xe7, 0x67, 0x8e,
+ 0xc4, 0x54, 0x97, 0xee, 0x11, 0xc1, 0xec, 0xa9, 0x52, 0x5e, 0xf6, 0xa7, 0x97, 0xdf, 0xfc, 0x33,
+ 0x9a, 0x58, 0x94, 0x59, 0xea, 0x01, 0x76, 0x8c, 0x6d, 0x92, 0x3e, 0xbe, 0xe4, 0x83, 0x4b, 0xa2,
+ 0xfc, 0x32, 0x58, 0x50, 0x9d, 0x55, 0x16, 0xe6, 0x42, 0x7f, 0x81, 0x8e, 0xdc, 0x57, 0xad, 0xad,
+ 0x9c, 0x30, 0xb6, 0x64, 0x71, 0xf8, 0xd3, 0x9a, 0xee, 0x08, 0xd4, 0x84, 0xc6, 0x7e, 0x95, 0xd5,
+ 0x0c, 0x66, 0x32, 0x11, 0xb5, 0x5a, 0x89, 0x7d, 0xd7, 0x39, 0xa5, 0x0a, 0x52, 0xf8, 0x60, 0x78,
+ 0xd6, 0xb5, 0xf0, 0xfa, 0xd7, 0x4e, 0x0f, 0x7f, 0xa6, 0x43, 0x2e, 0xf5, 0x19, 0x31, 0x31, 0x2e,
+ 0x00, 0xef, 0x8e, 0xf9, 0xa4, 0xb0, 0x09, 0xf6, 0x45, 0x38, 0xe7, 0xbd, 0x7a, 0xbd, 0xdc, 0xc9,
+ 0x3a, 0x81, 0xc6, 0x47, 0x7c, 0x57, 0x39, 0xa8, 0x68, 0xd6, 0xd7, 0x45, 0x9c, 0x0f, 0x2a, 0x6f,
+ 0xef, 0xa0, 0xea, 0x7d, 0xc7, 0x7a, 0x9f, 0xed, 0x79, 0x4a, 0x5c, 0xb5, 0x1d, 0xfc, 0xc5, 0x2c,
+ 0x0a, 0x9a, 0xbc, 0x37, 0xec, 0x71, 0xad, 0x1b, 0x48, 0xcc, 0x14, 0xed, 0x51, 0xde, 0xa9, 0x4b,
+ 0x14, 0x7b, 0xf6, 0x26, 0x5c, 0xfa, 0xf5, 0xab, 0x7a, 0x82, 0xcf, 0x67, 0x74, 0x6c, 0xd9, 0x08,
+ 0x7c, 0x64, 0x1e, 0xc4, 0x7a, 0xd3, 0xed, 0x6d, 0x63, 0x48, 0xf7, 0x4d, 0x39, 0x4c, 0x73, 0xf2,
+ 0xae, 0x4d, 0x7a, 0xb4, 0x63, 0xed, 0x2d, 0x2b, 0xe8, 0x65, 0x43, 0x2c, 0xc4, 0x62, 0x1b, 0x51,
+ 0x56, 0x4b, 0xab, 0x29, 0xad, 0x8b, 0xb8, 0xc0, 0x46, 0x14, 0x92, 0xe9, 0xc5, 0x47, 0x04, 0x03,
+ 0xe9, 0x5a, 0x30, 0xb0, 0x76, 0xcb, 0xb3, 0x18, 0xf3, 0xc6, 0x7a, 0x9a, 0xd7, 0xb7, 0xb8, 0xb1,
+ 0x0a, 0x14, 0xda, 0xc6, 0x7e, 0x95, 0xdd, 0x4e, 0x09, 0xf5, 0xb1, 0xe8, 0xd3, 0xe1, 0xe9, 0x47,
+ 0x5a, 0xd2, 0xbf, 0xf8, 0x7f, 0xcd, 0xff, 0x00, 0x91, 0xc7, 0xae, 0x97, 0x3c, 0xa0, 0xed, 0x1b,
+ 0x8d, 0x5e, 0xb0, 0xd1, 0xad, 0xa1, 0x61, 0x25, 0xe3, 0x9d, 0xfd, 0xa3, 0xda, 0x71, 0xff, 0x00,
+ 0xd7, 0xae, 0xc6, 0x19, 0x34, 0xdc, 0x82, 0x63, 0x74, 0x3e, 0xab, 0x4f, 0xba, 0xb9, 0xb0, 0xf2,
+ 0xf6, 0xa2, 0x97, 0x6f, 0x52, 0x2b, 0x69, 0xe1, 0x23, 0x28, 0x3f, 0x7e, 0xc7, 0x55, 0x3c, 0xb3,
+ 0x0b, 0x4e, 0x69, 0xa8, 0x49, 0xdb, 0xbf, 0xfc, 0x31, 0x81, 0x71, 0x79, 0x1c, 0x28, 0x42, 0x30,
+ 0xc0, 0xf4, 0xed, 0x5c, 0xbe, 0xad, 0x7a, 0x2e, 0xd3, 0xc9, 0x62, 0x58, 0x67, 0x8e, 0x7a, 0x57,
+ 0x51, 0x73, 0x04, 0x2c, 0xc4, 0xac, 0x60, 0x66, 0xb2, 0xe6, 0xd3, 0xad, 0xdf, 0x25, 0xa3, 0x5c,
+ 0xfa, 0x81, 0x5c, 0x30, 0xc2, 0xaa, 0x52, 0xba, 0x67, 0xb9, 0x52, 0x0e, 0x54, 0x9a, 0x85, 0xae,
+ 0xfb, 0x95, 0x21, 0xba, 0xfd, 0xda, 0xae, 0xec, 0xe0, 0x01, 0x9a, 0xb9, 0x0c, 0xf9, 0xef, 0x55,
+ 0xd7, 0x4f, 0x55, 0x1f, 0xbb, 0x1c, 0x7b, 0xd3, 0xbe, 0xcc, 0x55, 0x72, 0x4d, 0x65, 0x2c, 0x25,
+ 0xfa, 0x99, 0xd0, 0xa3, 0x55, 0x41, 0x2a, 0x8d, 0x5f, 0xc8, 0xbf, 0xe6, 0x60, 0x53, 0x4c, 0xac,
+ 0x7a, 0x64, 0x8a, 0xa6, 0x10, 0x81, 0xc3, 0x91, 0xf8, 0xd3, 0x77, 0xcc, 0x99, 0x1e, 0x69, 0xfa,
+ 0x75, 0xac, 0x96, 0x0d, 0xad, 0x99, 0xaf, 0xb3, 0x91, 0x24, 0xef, 0xc5, 0x50, 0x2f, 0x89, 0x45,
+ 0x3e, 0x49, 0x24, 0x27, 0x96, 0x07, 0xf0, 0xaa, 0xb2, 0x12, 0xa7, 0x76, 0x73, 0x8a, 0xd2, 0x38,
+ 0x69, 0x24, 0x4b, 0x84, 0x91, 0x34, 0xef, 0xc5, 0x72, 0xfa, 0xe8, 0xc4, 0xf1, 0xc9, 0xea, 0x31,
+ 0x5b, 0xcf, 0x26, 0xf1, 0x90, 0x6b, 0x0f, 0x5c, 0x19, 0x86, 0x37, 0xf4, 0x6c, 0x57, 0x66, 0x5f,
+ 0xee, 0x57, 0x47, 0x93, 0x99, 0xae, 0x6a, 0x0c, 0xaa, 0xa3, 0x9a, 0x50, 0x4f, 0x71, 0x4a, 0x83,
+ 0x93, 0xf4, 0xa4, 0x1c, 0xb5, 0x7d, 0x29, 0xf3, 0x42, 0xbb, 0x85, 0xc0, 0xcd, 0x69, 0xe9, 0x9a,
+ 0x1d, 0xe6, 0xa4, 0xbb, 0xe3, 0x50, 0x88, 0x7f, 0x8d, 0xba, 0x7e, 0x14, 0x68, 0x9a, 0x33, 0x6a,
+ 0xd7, 0xe5, 0x9d, 0x4f, 0xd9, 0xd0, 0x8d, 0xc7, 0xd7, 0xda, 0xbd, 0x3a, 0xca, 0xcd, 0x21, 0x8d,
+ 0x55, 0x54, 0x00, 0x06, 0x38, 0xaf, 0x0b, 0x35, 0xcd, 0xfe, 0xaa, 0xfd, 0x9d, 0x2f, 0x8b, 0xf2,
+ 0x3d, 0x2c, 0x16, 0x07, 0xda, 0xfb, 0xf3, 0xd8, 0xe2, 0x8f, 0x81, 0xa4, 0x68, 0xff, 0x00, 0xe3,
+ 0xf3, 0xe6, 0xff, 0x00, 0x73, 0x8f, 0xe7, 0x59, 0xc7, 0x45, 0xbd, 0xd1, 0xa6, 0x2f, 0x2a, 0x89,
+ 0x22, 0xfe, 0xfa, 0x74, 0x1f, 0x5f, 0x4a, 0xf5, 0x51, 0x18, 0x60, 0x42, 0x81, 0xc0, 0xc9, 0xaa,
+ 0xfa, 0x9e, 0x9c, 0x61, 0x50, 0xb2, 0x28, 0xcb, 0xae, 0xe1, 0xee, 0x2b, 0xc1, 0x8e, 0x71, 0x8a,
+ 0xa8, 0x9a, 0xa9, 0xac, 0x7d, 0x0f, 0x42, 0x59, 0x7e, 0x1a, 0x5e, 0xec, 0x74, 0x67, 0x9a, 0xbc,
+ 0x99, 0x18, 0x52, 0x3d, 0x49, 0xf4, 0xaa, 0xe6, 0xee, 0x28, 0xfe, 0xe9, 0x24, 0xfb, 0x75, 0x3f,
+ 0x8d, 0x1a, 0xd4, 0x2d, 0x67, 0x7c, 0xf0, 0xab, 0x85, 0x89, 0x8e, 0xe4, 0x00, 0x74, 0xf6, 0xaa,
+ 0xda, 0x66, 0x8d, 0x75, 0xab, 0xdd, 0x88, 0x6d, 0xdf, 0x0b, 0xfc, 0x4e, 0x47, 0x0b, 0x5e, 0xd5,
+ 0x19, 0x52, 0x85, 0x35, 0x3b, 0xfc, 0xce, 0x55, 0x2a, 0x38, 0x46, 0xe2, 0xfe, 0x2e, 0xa2, 0x9b,
+ 0xc7, 0xdc, 0x76, 0x36, 0xdc, 0xf6, 0x06, 0x98, 0x64, 0x61, 0x96, 0x2d, 0x9a, 0xf4, 0x1b, 0x1f,
+ 0x86, 0xd6, 0x51, 0x46, 0x1e, 0xe2, 0xe1, 0xe7, 0x6e, 0xa4, 0x16, 0xda, 0x3f, 0x4a, 0x9a, 0x5f,
+ 0x02, 0x78, 0x7a, 0xe4, 0x18, 0xcf, 0x9f, 0x6f, 0x20, 0xee, 0x92, 0xe7, 0xf9, 0xd6, 0x6f, 0x32,
+ 0xa2, 0xa5, 0x6d, 0x4c, 0xde, 0x63, 0x0e, 0x87, 0x97, 0xcb, 0x76, 0x57, 0xa1, 0xfc, 0x6a, 0xb3,
+ 0xce, 0x5c, 0x60, 0x75, 0x35, 0xd6, 0x6b, 0xbf, 0x0f, 0xe7, 0xd3, 0x4b, 0x4d, 0x69, 0x3b, 0x5e,
+ 0x40, 0x3f, 0x84, 0x0c, 0x38, 0xff, 0x00, 0x1a, 0xc3, 0x87, 0x46, 0x98, 0x42, 0xd7, 0x2f, 0x14,
+ 0x9e, 0x42, 0x1c, 0x39, 0x8d, 0x77, 0x63, 0xea, 0x6b, 0xb6, 0x9d, 0x7a, 0x75, 0x23, 0xcd, 0x17,
+ 0x72, 0x96, 0x2a, 0xf1, 0xbd, 0xff, 0x00, 0xcc, 0xab, 0x6d, 0x0f, 0x97, 0x3a, 0x31, 0x70, 0x5b,
+ 0xd2, 0xba, 0x3b, 0x7b, 0xed, 0xb1, 0x85, 0x07, 0x8a, 0xcf, 0x8d, 0xf4, 0x66, 0x42, 0x86, 0xda,
+ 0xeb, 0x79, 0xc8, 0x57, 0x59, 0x01, 0x20, 0xf6, 0x38, 0xc5, 0x42, 0x91, 0x5c, 0x31, 0x45, 0x81,
+ 0x1e, 0x72, 0x78, 0xdb, 0x1a, 0x92, 0xc0, 0xfa, 0x11, 0x4a, 0x6f, 0x99, 0x9d, 0x78, 0x3c, 0xc2,
+ 0x8c, 0x7d, 0xcb, 0x9d, 0x5d, 0xb4, 0xec, 0xe9, 0x90, 0xc6, 0xb6, 0xad, 0x01, 0xb8, 0xd3, 0xf1,
+ 0x71, 0xfe, 0xa9, 0x1f, 0x72, 0x96, 0xef, 0x5c, 0xfd, 0xad, 0xad, 0xed, 0xb5, 0xb9, 0x17, 0x16,
+ 0xb3, 0xaf, 0x7e, 0x50, 0xf1, 0x54, 0xae, 0xb5, 0x5b, 0xa0, 0xad, 0x14, 0x72, 0xe2, 0x31, 0xd0,
+ 0x7a, 0x57, 0x25, 0x78, 0xce, 0x51, 0xb5, 0x33, 0xd2, 0x9c, 0xfd, 0xac, 0x3f, 0x76, 0xce, 0xda,
+ 0x0d, 0x62, 0x77, 0x91, 0x34, 0xfd, 0x38, 0xec, 0x67, 0x3c, 0xb0, 0x18, 0x38, 0xef, 0xcf, 0x5c,
+ 0x57, 0x53, 0xa5, 0xe9, 0x62, 0x28, 0xc4, 0x71, 0x82, 0x4f, 0x56, 0x63, 0xd4, 0x9f, 0x5a, 0xe3,
+ 0xfc, 0x03, 0x63, 0xb6, 0xce, 0x4d, 0x42, 0x52, 0x5a, 0x69, 0xdb, 0x6a, 0x93, 0xd9, 0x47, 0xf8,
+ 0x9a, 0xf4, 0x38, 0x24, 0x31, 0xa6, 0xd5, 0xef, 0xd6, 0xbe, 0x4f, 0x1d, 0x52, 0x2a, 0xaf, 0xb2,
+ 0x6f, 0x45, 0xb9, 0xe5, 0xd5, 0x8f, 0xb2, 0x5c, 0xb1, 0xdc, 0xd4, 0xb3, 0xb6, 0x8e, 0xde, 0x3c,
+ 0xe5, 0x77, 0x77, 0xa7, 0x4e, 0xec, 0xa3, 0x72, 0x3d, 0x67, 0x0b, 0x83, 0x1f, 0x3d, 0x4d, 0x45,
+ 0x25, 0xe3, 0xb6, 0x7e, 0x6f, 0xc2, 0x85, 0x8e, 0xa4, 0xa9, 0xf2, 0x45, 0x58, 0xe0, 0xf6, 0x32,
+ 0x94, 0xae, 0xc7, 0x4d, 0x75, 0x23, 0x37, 0xcc, 0x73, 0x55, 0xde, 0x4c, 0x92, 0x6a, 0x26, 0x93,
+ 0x27, 0x9a, 0x89, 0xe4, 0xaf, 0x36, 0x52, 0x94, 0xdd, 0xdb, 0x3b, 0x21, 0x4d, 0x22, 0x46, 0x93,
+ 0x15, 0x04, 0x92, 0xf1, 0x51, 0xbc, 0xd8, 0x15, 0x4e, 0x6b, 0x90, 0x88, 0xcc, 0x7b, 0x0c, 0xd5,
+ 0xc2, 0x9d, 0xce, 0x98, 0x52, 0x6c, 0xc1, 0xd7, 0x6f, 0x51, 0xef, 0x44, 0x67, 0x05, 0x63, 0xfd,
+ 0x4d, 0x64, 0x3d, 0xe2, 0x0c, 0xfa, 0x10, 0x6b, 0x3e, 0xfe, 0xf4, 0xc9, 0x3b, 0xb9, 0x3c, 0x93,
+ 0x9a, 0xcf, 0x37, 0x0c, 0xed, 0x82, 0x78, 0xf6, 0xaf, 0xb2, 0xc2, 0x51, 0xe4, 0xa2, 0xa0, 0x7a,
+ 0x8e, 0x4a, 0x95, 0x3f, 0x43, 0x49, 0x35, 0x09, 0x11, 0xbc, 0xbd, 0xff, 0x00, 0x2e, 0x78, 0x06,
+ 0xb6, 0xad, 0xa6, 0x00, 0x65, 0xc0, 0xe9, 0xd3, 0xd2, 0xb9, 0x12, 0xc5, 0x88, 0x28, 0x73, 0xcf,
+ 0xd2, 0xba, 0x14, 0x9f, 0x30, 0xe3, 0xa6, 0x18, 0xe6, 0xba, 0xd2, 0xb6, 0x84, 0xe1, 0xf1, 0x54,
+ 0xeb, 0xab, 0xc1, 0xdc, 0xe8, 0x4c, 0x72, 0x9b, 0x01, 0x74, 0x8b, 0x98, 0xb3, 0x82, 0x73, 0xd2,
+ 0xb3, 0xe4, 0xbb, 0xd9, 0x27, 0x18, 0x3c, 0x77, 0xaa, 0xeb, 0x78, 0x45, 0xa7, 0x94, 0x24, 0x38,
+ 0xdc, 0x49, 0x5c, 0xf1, 0x59, 0xd7, 0x17, 0x4a, 0xad, 0xc1, 0xed, 0x54, 0xae, 0xf5, 0x37, 0x8e,
+ 0x97, 0xb9, 0x7a, 0x5b, 0xf7, 0x76, 0xeb, 0x51, 0x7d, 0xa5, 0xc9, 0xe0, 0xf3, 0x59, 0x0d, 0x76,
+ 0x3a, 0xf3, 0x4a, 0x2f, 0x17, 0x1d, 0xc5, 0x1c, 0xa5, 0xdf, 0xb1, 0xb1, 0x1d, 0xc0, 0x52, 0x4e,
+ 0x06, 0x69, 0x8d, 0x30, 0x6c, 0xe5, 0x6b, 0x30, 0x5d, 0x80, 0x39, 0x1d, 0xfa, 0xd2, 0x3d, 0xf8,
+ 0xda, 0x76, 0x8a, 0x39, 0x45, 0xcc, 0xcb, 0x6f, 0x2e, 0xd3, 0x80, 0x69, 0xa6, 0x71, 0xbb, 0x76,
+ 0x79, 0xac, 0x99, 0x6e, 0x89, 0x60, 0x49, 0xaa, 0xed, 0x72, 0xd9, 0xce, 0x4d, 0x0a, 0x02, 0x72,
+ 0x35, 0xe4, 0x7d, 0xe4, 0x8f, 0xc6, 0xaa, 0x48, 0xfc, 0xe3, 0x39, 0xaa, 0x2b, 0x72, 0xe1, 0xb3,
+ 0xb8, 0xd4, 0xcb, 0x72, 0xa4, 0xfc, 0xe3, 0xf1, 0xab, 0x50, 0x25, 0xcd, 0x88, 0x64, 0x28, 0xd9,
+ 0xfc, 0xea, 0x96, 0xa8, 0x43, 0xda, 0xe3, 0xaf, 0x22, 0xa6, 0x95, 0xd7, 0x27, 0x06, 0xa8, 0x5c,
+ 0xc9, 0xb9, 0x42, 0xe7, 0xa1, 0xad, 0x29, 0x52, 0xbd, 0x58, 0xc9, 0x1e, 0x56, 0x67, 0x65, 0x45,
+ 0xc8, 0x6a, 0xb1, 0x1c, 0x62, 0x9f, 0x6f, 0x13, 0xcf, 0x70, 0x91, 0x20, 0xcb, 0x39, 0xc0, 0xa8,
+ 0x17, 0x35, 0xd3, 0x78, 0x52, 0xc7, 0xcc, 0xba, 0x6b, 0xa7, 0x1c, 0x27, 0xca, 0xbf, 0x5a, 0xef,
+ 0xc5, 0xe2, 0x16, 0x1e, 0x8c, 0xaa, 0x3e, 0x87, 0xce, 0xd0, 0xa5, 0xed, 0x6a, 0x28, 0x9d, 0x8e,
+ 0x8d, 0xa7, 0xa5, 0x95, 0xa4, 0x70, 0xa0, 0xe0, 0x0f, 0x98, 0xfa, 0x9a, 0xda, 0x4e, 0x05, 0x53,
+ 0xb7, 0x1f, 0x2f, 0xb5, 0x5c, 0x5e, 0x9e, 0xd5, 0xf9, 0xcd, 0x69, 0xca, 0x73, 0x72, 0x96, 0xec,
+ 0xfa, 0x88, 0xa5, 0x14, 0xa2, 0x8b, 0x56, 0x4d, 0x8b, 0xb4, 0xf9, 0x77, 0x03, 0xc3, 0x0f, 0x51,
+ 0x50, 0xde, 0xb3, 0x5c, 0x4e, 0x78, 0x21, 0x57, 0xe5, 0x00, 0xf6, 0x14, 0xfb, 0x5b, 0x83, 0x6d,
+ 0x32, 0xcc, 0x06, 0x4a, 0xf6, 0xa8, 0xee, 0x6e, 0xbc, 0xd9, 0x24, 0x9d, 0xc0, 0x19, 0xe7, 0x03,
+ 0xa0, 0xa4, 0xa5, 0xee, 0x59, 0x6f, 0x71, 0x5a, 0xd3, 0xe6, 0x7b, 0x58, 0xe7, 0xef, 0xf4, 0x7d,
+ 0x3d, 0x26, 0x17, 0x73, 0xc1, 0xf6, 0x89, 0xf1, 0xb6, 0x35, 0x7e, 0x40, 0xf7, 0xc5, 0x3b, 0x49,
+ 0x5f, 0x26, 0x52, 0xc1, 0x00, 0x03, 0x3f, 0x75, 0x71, 0xcd, 0x59, 0x5d, 0xf3, 0xc8, 0x5d, 0x86,
+ 0xe6, 0x3c, 0x0e, 0x78, 0x51, 0x57, 0x23, 0xb8, 0x4b, 0x65, 0xf2, 0x20, 0x8d, 0x1e, 0x4f, 0xe2,
+ 0x2c, 0x38, 0x15, 0xe8, 0x52, 0x8d, 0x49, 0x2e, 0x4d, 0xd9, 0xe0, 0xd7, 0xa9, 0x53, 0x1b, 0x5b,
+ 0x96, 0x92, 0xd3, 0xfa, 0xd5, 0x8d, 0xbb, 0xd7, 0x24, 0x8a, 0xd8, 0x42, 0xa7, 0x03, 0x39, 0xc0,
+ 0xef, 0x59, 0x2f, 0x7b, 0x73, 0x23, 0x86, 0x11, 0xbe, 0x73, 0xd7, 0x15, 0xb7, 0x15, 0x99, 0x9e,
+ 0x5d, 0xd2, 0x15, 0xdc, 0x7a, 0x9e, 0x00, 0x15, 0x74, 0x69, 0x96, 0x80, 0x7c, 0xf7, 0x08, 0x3f,
+ 0x5a, 0xee, 0xa7, 0x97, 0x39, 0x2f, 0x79, 0x9d, 0x11, 0xcb, 0x23, 0x1f, 0xe2, 0x4f, 0x5f, 0x24,
+ 0x71, 0xfa, 0x8d, 0xe5, 0xd4, 0xb0, 0x88, 0x5e, 0x39, 0x0a, 0x36, 0x72, 0xc0, 0x13, 0x8a, 0xc0,
+ 0xb4, 0x99, 0xb4, 0x9b, 0x69, 0x23, 0x5f, 0x32, 0x50, 0xec, 0x47, 0xcc, 0x87, 0x81, 0xf8, 0x8a,
+ 0xf4, 0xa6, 0xd3, 0xad, 0x09, 0x21, 0x6e, 0xd4, 0x7d, 0x45, 0x57, 0x9b, 0x46, 0x88, 0x0f, 0x92,
+ 0x68, 0x98, 0x1f, 0x43, 0x5e, 0x85, 0x2a, 0x32, 0xa5, 0x4f, 0x91, 0x6c, 0x6b, 0xfd, 0x99, 0x41,
+ 0xed, 0x36, 0xbd, 0x51, 0xe7, 0x3a, 0x3e, 0x9d, 0x0c, 0xfb, 0xe4, 0x31, 0x86, 0x50, 0xdc, 0x8c,
+ 0xf2, 0x05, 0x75, 0x50, 0xe9, 0xe2, 0xc5, 0x0b, 0x27, 0xee, 0x21, 0x73, 0xfb, 0xd9, 0x3f, 0x8c,
+ 0x8e, 0xc0, 0x0e, 0xa7, 0xf9, 0x53, 0x35, 0x1b, 0xf8, 0x74, 0x2d, 0x45, 0x60, 0x10, 0xc3, 0x24,
+ 0xa1, 0x03, 0xee, 0xcf, 0xca, 0x33, 0xd0, 0x56, 0x34, 0xfa, 0xc4, 0xf7, 0x37, 0x46, 0x69, 0xe4,
+ 0x2e, 0x4f, 0x18, 0xed, 0x8f, 0x40, 0x3d, 0x29, 0xfb, 0x09, 0x49, 0xde, 0x5b, 0x1c, 0xff, 0x00,
+ 0xd9, 0x57, 0xa9, 0xca, 0xa5, 0xee, 0xf7, 0xb7, 0xe4, 0x6a, 0xb2, 0x2c, 0x36, 0xc1, 0xd0, 0xb8,
+ 0x9d, 0xb9, 0x46, 0x3d, 0x08, 0xcf, 0xa5, 0x73, 0xba, 0xb5, 0xfc, 0x77, 0x71, 0x4a, 0x24, 0xb3,
+ 0x55, 0xb9, 0x50, 0x31, 0x2a, 0x1c, 0x02, 0x73, 0xcf, 0x1d, 0xf2, 0x2a, 0xd4, 0xba, 0xa4, 0x92,
+ 0xa2, 0xae, 0xec, 0x84, 0x18, 0x5f, 0x61, 0xe9, 0x51, 0xe9, 0x85, 0x66, 0xd5, 0xd1, 0x24, 0x50,
+ 0xc2, 0x42, 0x01, 0x04, 0x77, 0xcd, 0x6b, 0x57, 0x96, 0x9c, 0x1d, 0x4b, 0x6c, 0x7a, 0xab, 0x09,
+ 0x4e, 0x2d, 0x4a, 0x0a, 0xcd, 0x76, 0xfd, 0x4e, 0xf3, 0xc2, 0x68, 0xd6, 0xfa, 0x35, 0xac, 0x32,
+ 0x80, 0xae, 0xa9, 0xc8, 0xf4, 0xae, 0xa2, 0x37, 0xe3, 0xad, 0x72, 0x31, 0xcc, 0xd0, 0x39, 0xfe,
+ 0xed, 0x6c, 0x59, 0xde, 0x6e, 0x51, 0xcd, 0x7c, 0x26, 0x2a, 0x9c, 0xa7, 0x27, 0x3e, 0xe2, 0xad,
+ 0x49, 0xcb, 0xde, 0x46, 0xd0, 0xdc, 0xe0, 0x90, 0x33, 0x8a, 0xae, 0xe6, 0x88, 0xbc, 0x43, 0x65,
+ 0xa2, 0x93, 0xf6, 0xc9, 0xa2, 0x41, 0x3a, 0x95, 0x50, 0xe7, 0x19, 0xf5, 0xc5, 0x51, 0x5d, 0x5e,
+ 0xc2, 0xe9, 0x89, 0x86, 0xf2, 0xdd, 0xf2, 0x7a, 0x2c, 0x82, 0xb3, 0xfa, 0xac, 0xbd, 0x9c, 0x6a,
+ 0x45, 0x37, 0x7b, 0xf4, 0x76, 0xfb, 0xce, 0x28, 0xbb, 0x4d, 0xc5, 0x93, 0xbb, 0x55, 0x69, 0x25,
+ 0xc7, 0x14, 0x97, 0x37, 0x51, 0x42, 0xb9, 0x77, 0x0a, 0x0d, 0x43, 0x69, 0x2d, 0xae, 0xa6, 0x19,
+ 0x6d, 0xee, 0x00, 0x94, 0x67, 0xe5, 0x93, 0x8a, 0xe8, 0xa1, 0x82, 0xab, 0x56, 0x3c, 0xd1, 0x5a,
+ 0x1d, 0x2a, 0x70, 0x83, 0xb4, 0x9e, 0xa3, 0x1e, 0x5a, 0xcc, 0xbf, 0xb8, 0xc4, 0x2e, 0x33, 0xd4,
+ 0x11, 0x56, 0x2e, 0x24, 0xf2, 0xc9, 0x07, 0xa8, 0xae, 0x7b, 0x53, 0xb9, 0x25, 0x18, 0x03, 0xd7,
+ 0x8a, 0xe8, 0xa3, 0x41, 0xf3, 0xd9, 0xa3, 0xba, 0x93, 0x8b, 0x57, 0x47, 0x33, 0x3f, 0x2c, 0x73,
+ 0xeb, 0xd6, 0x9d, 0x6d, 0x64, 0xd7, 0x44, 0x88, 0x79, 0x6c, 0x73, 0xe8, 0x07, 0xa9, 0xad, 0x7f,
+ 0xb2, 0x6e, 0x80, 0x30, 0x4e, 0xdc, 0x9c, 0x56, 0xc7, 0x87, 0x3f, 0xb3, 0x60, 0xb1, 0xba, 0x7b,
+ 0x86, 0x55, 0x93, 0x77, 0x0e, 0x7a, 0x02, 0x07, 0x00, 0xfe, 0x75, 0xf5, 0x09, 0xb5, 0x05, 0x63,
+ 0x9f, 0x33, 0xa8, 0xe3, 0x41, 0xdb, 0xae, 0x87, 0x3f, 0x77, 0xa5, 0x25, 0x8d, 0xb2, 0xed, 0x7d,
+ 0xee, 0xa3, 0x24, 0xf6, 0x3c, 0x54, 0x31, 0xc8, 0x41, 0x04, 0x9e, 0x08, 0x07, 0x1f, 0x85, 0x5b,
+ 0xbc, 0x0f, 0x2c, 0xcc, 0xc2, 0x6c, 0xc6, 0xd9, 0xe8, 0x77, 0x56, 0x5d, 0xcd, 0xc7, 0x95, 0x33,
+ 0xa1, 0x18, 0xda, 0x71, 0xc5, 0x54, 0x13, 0x95, 0x8f, 0x3b, 0x24, 0x6e, 0x35, 0x26, 0x9b, 0xe8,
+ 0x59, 0x7b, 0xad, 0xa4, 0xe2, 0xa9, 0x19, 0x7c, 0xc9, 0x0e, 0xe2, 0x71, 0x55, 0x65, 0xb8, 0x62,
+ 0x73, 0xeb, 0x49, 0x1c, 0x85, 0x8f, 0xf3, 0xae, 0x85, 0x0b, 0x1f, 0x43, 0xce, 0x4e, 0x5a, 0x80,
+ 0x49, 0xe9, 0x4c, 0x0c, 0x0b, 0x85, 0x15, 0x61, 0x30, 0x0e, 0x17, 0x39, 0xa3, 0x94, 0x3d, 0xa5,
+ 0x86, 0xaa, 0x96, 0x18, 0xdd, 0xd3, 0x9c, 0x1a, 0x8e, 0x46, 0xdb, 0xc7, 0x39, 0xa9, 0x58, 0x81,
+ 0x9c, 0xf0, 0x6a, 0xb4, 0xee, 0xa5, 0x7a, 0x8c, 0xd1, 0xca, 0x2e, 0x72, 0x19, 0x64, 0xc9, 0xa8,
+ 0x0b, 0xd2, 0x48, 0xe2, 0xa1, 0x2f, 0x5a, 0xc6, 0x1a, 0x18, 0xce, 0xaa, 0x4c, 0x9c, 0x4c, 0x50,
+ 0x82, 0x3a, 0x8a, 0x43, 0x29, 0xf5, 0xaa, 0xc5, 0xcd, 0x35, 0x9b, 0x8e, 0xbc, 0xfa, 0x55, 0x72,
+ 0x98, 0xbc, 0x42, 0x44, 0xcf, 0x2e, 0x3b, 0xd5, 0x72, 0xf9, 0x63, 0x51, 0xc8, 0x5c, 0xa9, 0xd8,
+ 0x39, 0xa8, 0x95, 0xca, 0xae, 0x3f, 0x3a, 0xe8, 0xa1, 0x04, 0x9d, 0xcf, 0x1b, 0x32, 0xc5, 0x4a,
+ 0x49, 0x43, 0xa1, 0xa6, 0xb1, 0xf2, 0x3d, 0xfa, 0x57, 0xa0, 0x68, 0xd6, 0xa2, 0xda, 0xce, 0x28,
+ 0xc0, 0xe7, 0x19, 0x3f, 0x5a, 0xf3, 0xfd, 0x29, 0x4c, 0xda, 0x94, 0x31, 0x96, 0x2c, 0x37, 0x64,
+ 0xe7, 0xda, 0xbd, 0x1e, 0x17, 0xd8, 0x82, 0xbc, 0x7c, 0xfa, 0xab, 0xf7, 0x69, 0x2f, 0x51, 0xe5,
+ 0xb1, 0xde, 0x66, 0xca, 0x30, 0x0a, 0x00, 0xa9, 0x7c, 0xc1, 0xb7, 0x93, 0x80, 0x2b, 0x25, 0x6e,
+ 0x82, 0x02, 0x58, 0xf0, 0x2a, 0x36, 0xb8, 0x79, 0x48, 0xc9, 0xda, 0xbe, 0x95, 0xf3, 0x1e, 0xc5,
+ 0xc9, 0x9d, 0xd5, 0xf1, 0x70, 0xa0, 0xb5, 0xd5, 0xf6, 0x35, 0x1e, 0xf5, 0x57, 0x84, 0x52, 0xde,
+ 0xfd, 0x05, 0x53, 0xb8, 0x90, 0x98, 0xc9, 0x2c, 0x59, 0xbd, 0x07, 0x41, 0x4b, 0x1c, 0x91, 0x0f,
+ 0xbc, 0x49, 0x3e, 0xd5, 0x0c, 0xf7, 0x4a, 0x61, 0x2a, 0x14, 0x0e, 0x7a, 0xd6, 0xb0, 0xa5, 0x18,
+ 0xec, 0x78, 0xd5, 0xb1, 0x55, 0xab, 0xe9, 0x27, 0xa7, 0x61, 0xcd, 0x76, 0x2d, 0x6d, 0x40, 0x0d,
+ 0x99, 0x9b, 0x81, 0xed, 0x4f, 0xb4, 0x94, 0x20, 0x19, 0xea, 0x79, 0xcd, 0x73, 0xb7, 0x77, 0x58,
+ 0xb9, 0x88, 0x9c, 0xed, 0x02, 0xb4, 0x16, 0xf6, 0x37, 0x00, 0x29, 0xed, 0x5e, 0xce, 0x1a, 0x8a,
+ 0x54, 0xef, 0xdc, 0xf7, 0x72, 0xca, 0x4a, 0x9d, 0x14, 0xd6, 0xef, 0x73, 0x78, 0x5d, 0x8f, 0xef,
+ 0x55, 0xdd, 0x3e, 0x5b, 0x79, 0x24, 0xcc, 0xe7, 0xe5, 0x15, 0xcc, 0x2d, 0xdf, 0x40, 0x4f, 0x4a,
+ 0x9e, 0x1b, 0xc0, 0x9b, 0xb8, 0x04, 0x1a, 0xd5, 0xe8, 0xee, 0x77, 0xca, 0x0a, 0x4a, 0xc7, 0x45,
+ 0x79, 0x32, 0x33, 0x28, 0x8d, 0x00, 0x4f, 0x6a, 0xcf, 0x9a, 0x40, 0x88, 0x49, 0xc8, 0xc7, 0xa5,
+ 0x5c, 0xd0, 0xf4, 0x2b, 0xfd, 0x70, 0xf9, 0x91, 0x0f, 0x26, 0xdf, 0x38, 0x33, 0x3f, 0x4f, 0xc3,
+ 0xd6, 0xba, 0xd4, 0xf8, 0x7f, 0xa7, 0x98, 0x80, 0xba, 0xd4, 0x2e, 0x25, 0xf5, 0xdb, 0x85, 0x1f,
+ 0xd6, 0xb4, 0x8a, 0x73, 0xd8, 0xe2, 0xab, 0x8d, 0xc3, 0x61, 0x9f, 0x24, 0xa5, 0xaf, 0x96, 0xa7,
+ 0x86, 0x78, 0x99, 0xbe, 0xd1, 0x72, 0xb3, 0xa8, 0x39, 0x0b, 0xb5, 0xbd, 0xfd, 0x2b, 0x3e, 0x29,
+ 0x50, 0xc4, 0xa3, 0x27, 0x38, 0xaf, 0x7f, 0x97, 0xe1, 0x6f, 0x86, 0x2e, 0x14, 0xee, 0x17, 0x2c,
+ 0xde, 0xa6, 0x73, 0x5c, 0xa6, 0xb5, 0xf0, 0x8b, 0x4f, 0xd8, 0xff, 0x00, 0xd9, 0x57, 0x53, 0x5b,
+ 0x4e, 0x39, 0x09, 0x31, 0xde, 0x8d, 0xf8, 0xf5, 0x15, 0xa4, 0xea, 0x7b, 0x28, 0xae, 0x7d, 0xbb,
+ 0x9c, 0xcf, 0x34, 0xa1, 0x56, 0x5e, 0xe5, 0xd7, 0xc8, 0xf2, 0xcc, 0x1d, 0xe0, 0x86, 0xc0, 0xf5,
+ 0xc5, 0x5d, 0xb0, 0x98, 0x5a, 0x5f, 0xc7, 0x72, 0x8b, 0xb9, 0x57, 0xa0, 0x23, 0x26, 0xab, 0x6a,
+ 0xfa, 0x75, 0xfe, 0x83, 0x76, 0x6d, 0x6f, 0xa2, 0xda, 0x7f, 0x85, 0x81, 0xca, 0xb7, 0xd2, 0xa9,
+ 0x47, 0x79, 0xb5, 0xc7, 0x3c, 0x67, 0x35, 0xa2, 0xe5, 0xab, 0x0b, 0x6e, 0x99, 0xd5, 0x0a, 0xd1,
+ 0x67, 0x7a, 0xda, 0xbc, 0x37, 0x31, 0x05, 0x55, 0x2a, 0x7a, 0x93, 0x9c, 0xd5, 0xad, 0x36, 0xf4,
+ 0x29, 0xd8, 0x58, 0x1e, 0x78, 0xae, 0x4e, 0xcf, 0x52, 0x45, 0x8c, 0xa0, 0x65, 0xf9, 0xc8, 0xce,
+ 0x47, 0x3c, 0x57, 0x4f, 0x6d, 0x0d, 0xa3, 0xda, 0x09, 0x25, 0x78, 0x83, 0x2a, 0xa9, 0x3b, 0x67,
+ 0xc1, 0x39, 0xf6, 0x23, 0xb5, 0x79, 0xf5, 0xb2, 0xa8, 0x4d, 0x5a, 0x32, 0xb1, 0xb7, 0x3c, 0x52,
+ 0xd0, 0xe8, 0xbc, 0xc8, 0x27, 0x55, 0xf3, 0x63, 0x8e, 0x4c, 0x74, 0xde, 0xa1, 0xb1, 0xf4, 0xcd,
+ 0x57, 0xba, 0xb0, 0xd2, 0xe7, 0x52, 0x25, 0xb1, 0xb6, 0x6f, 0x71, 0x18, 0x07, 0xf3, 0x15, 0x9a,
+ 0x1e, 0x08, 0x58, 0x81, 0x74, 0xea, 0x14, 0x9c, 0xef, 0x19, 0x1c, 0x7b, 0x8a, 0xab, 0x2e, 0xa5,
+ 0x23, 0x2b, 0x98, 0xc1, 0x74, 0x53, 0xf7, 0x87, 0xa7, 0xae, 0x2b, 0xc9, 0x9e, 0x53, 0x89, 0xa4,
+ 0xef, 0x07, 0x75, 0xe4, 0xcc, 0x5d, 0x38, 0x3d, 0x6c, 0x73, 0x17, 0x5a, 0x94, 0x9a, 0x5d, 0xe8,
+ 0x58, 0x1d, 0x8d, 0xb9, 0x24, 0xaa, 0x4a, 0xdb, 0xc2, 0xfd, 0x2b, 0x43, 0x4b, 0xd4, 0x92, 0xe2,
+ 0xf5, 0x2e, 0x78, 0xe1, 0xf3, 0xc7, 0x00, 0xe3, 0xd6, 0xb9, 0xbd, 0x42, 0xea, 0x3f, 0xb7, 0x48,
+ 0x8e, 0x7e, 0x52, 0xdb, 0x80, 0x23, 0xa7, 0xb5, 0x3e, 0x3d, 0x42, 0x14, 0x4c, 0x82, 0x32, 0x06,
+ 0x01, 0xc6, 0x31, 0x5e, 0xf7, 0x2f, 0xb8, 0x9f, 0x5b, 0x1f, 0x2f, 0x24, 0xe1, 0x88, 0x77, 0xd2,
+ 0xcc, 0xea, 0xef, 0x35, 0x62, 0x65, 0xce, 0xec, 0x9f, 0xad, 0x53, 0xbb, 0x94, 0x4b, 0x08, 0x91,
+ 0x7f, 0x84, 0xfc, 0xc3, 0xfa, 0xd7, 0x31, 0xf6, 0xd7, 0x92, 0x7c, 0x80, 0xc4, 0x7b, 0x0a, 0xd0,
+ 0x8e, 0xec, 0xe3, 0x83, 0xcf, 0x71, 0x5c, 0x6f, 0x0c, 0xe1, 0x66, 0x7a, 0x14, 0x31, 0xcf, 0xda,
+ 0x73, 0x9d, 0x2d, 0xa5, 0xe2, 0x2d, 0xb8, 0x04, 0xa9, 0xc8, 0xc7, 0x35, 0x97, 0x70, 0xbb, 0x19,
+ 0xda, 0xd8, 0xed, 0x39, 0xce, 0x07, 0x35, 0x97, 0x65, 0x15, 0xe5, 0xed, 0xe3, 0x41, 0x6e, 0x09,
+ 0x41, 0xd5, 0xcf, 0x45, 0x15, 0xbe, 0x2c, 0x7f, 0xb3, 0x62, 0x91, 0x5c, 0xf9, 0xd2, 0x48, 0xb8,
+ 0xc9, 0xe3, 0x6f, 0xb8, 0xf7, 0xae, 0x98, 0xfb, 0xba, 0x36, 0x7a, 0xf8, 0xb4, 0xf1, 0x38, 0x69,
+ 0x3a, 0x7a, 0x98, 0x91, 0xdc, 0x5e, 0xac, 0xea, 0x89, 0x21, 0x2a, 0xdd, 0x78, 0xfe, 0x54, 0xe9,
+ 0x34, 0xcb, 0xdb, 0xa9, 0x0b, 0x42, 0x1a, 0x56, 0x63, 0x80, 0xa0, 0x64, 0xd5, 0xab, 0x77, 0x6b,
+ 0x9b, 0x93, 0x1b, 0x22, 0xec, 0x5f, 0xe2, 0xf5, 0x35, 0x7f, 0xed, 0x62, 0xde, 0x4f, 0xdd, 0xf0,
+ 0x70, 0x46, 0x41, 0xc5, 0x69, 0x16, 0xd3, 0xd1, 0x1c, 0x99, 0x56, 0x05, 0xc7, 0xf7, 0xd3, 0xf9,
+ 0x1c, 0xeb, 0x69, 0x73, 0xed, 0x25, 0xf0, 0xac, 0x38, 0x23, 0x35, 0x1a, 0x42, 0x63, 0xcf, 0x42,
+ 0x6b, 0x4e, 0x79, 0x72, 0xcd, 0xdb, 0x35, 0x55, 0xa3, 0x23, 0xe6, 0x1c, 0xf3, 0xd6, 0xba, 0x54,
+ 0x9b, 0x3d, 0x86, 0xac, 0x45, 0x14, 0x78, 0x6c, 0xe3, 0x91, 0x53, 0x60, 0xae, 0x41, 0x18, 0x6a,
+ 0x47, 0x4d, 0xbb, 0x4e, 0xec, 0x12, 0x7a, 0x54, 0xea, 0x87, 0x3b, 0x99, 0xb8, 0xeb, 0xf8, 0xd1,
+ 0x7b, 0x0a, 0xd7, 0xd4, 0xcb, 0x9d, 0xa4, 0x6c, 0xf5, 0xaa, 0xcd, 0x1c, 0x8e, 0x09, 0x03, 0x23,
+ 0xda, 0xb6, 0x24, 0x55, 0x24, 0x9e, 0xa3, 0x3d, 0x2a, 0x38, 0x82, 0xc6, 0x8f, 0xbb, 0xf0, 0xaa,
+ 0x8c, 0x91, 0x13, 0x52, 0xb6, 0x85, 0x0d, 0x27, 0x4c, 0x93, 0x58, 0xd5, 0x61, 0xb1, 0x49, 0x63,
+ 0x89, 0xa5, 0x38, 0x0d, 0x23, 0x00, 0x33, 0xe8, 0x33, 0xdf, 0xd0, 0x57, 0xa9, 0xdc, 0x7c, 0x16,
+ 0xb7, 0x4b, 0x37, 0x6b, 0x5d, 0x42, 0x69, 0xa7, 0xf2, 0x8b, 0x46, 0x5b, 0x00, 0x33, 0x76, 0x18,
+ 0xc7, 0x19, 0xe9, 0xd6, 0xb9, 0xff, 0x00, 0x87, 0xde, 0x0e, 0xb9, 0xd7, 0x75, 0xb8, 0xef, 0x9a,
+ 0x36, 0x5b, 0x2b, 0x67, 0x0f, 0xbc, 0x8f, 0xbe, 0xc3, 0xa0, 0x1f, 0xd6, 0xbd, 0xfe, 0x2b, 0x17,
+ 0x58, 0xd5, 0x4e, 0x38, 0x1f, 0x95, 0x6c, 0xb9, 0x9a, 0xd1, 0x1f, 0x3f, 0x8e, 0xc4, 0xba, 0x75,
+ 0x79, 0x63, 0x2d, 0x8f, 0x95, 0x2e, 0xf4, 0xa7, 0xb0, 0xba, 0x96, 0xda, 0xe2, 0x06, 0x8a, 0x68,
+ 0x89, 0x57, 0x47, 0xea, 0xa6, 0xa1, 0x8d, 0x21, 0x47, 0xf9, 0x80, 0x3c, 0x76, 0x35, 0xee, 0x3f,
+ 0x11, 0x7c, 0x05, 0x75, 0xac, 0x01, 0xa9, 0x69, 0xc0, 0x3d, 0xe4, 0x69, 0x87, 0x8b, 0xbc, 0xa3,
+ 0xb6, 0x0f, 0xa8, 0xfd, 0x6b, 0xc3, 0x6f, 0x6d, 0xee, 0x2c, 0xae, 0x5e, 0x0b, 0xa8, 0x64, 0x82,
+ 0x64, 0x38, 0x68, 0xe4, 0x52, 0xac, 0x3f, 0x03, 0x49, 0xdd, 0x1d, 0x78, 0x6a, 0xb4, 0xeb, 0xc6,
+ 0xfd, 0x4a, 0xf2, 0x44, 0x8b, 0x33, 0x01, 0x82, 0x0f, 0x22, 0xa0, 0x58, 0xa3, 0x66, 0x2c, 0x54,
+ 0x66, 0x9c, 0xf2, 0x52, 0x26, 0x42, 0xe7, 0xd6, 0xb6, 0xc3, 0xa6, 0xe5, 0x73, 0x3c, 0xc1, 0xc5,
+ 0x52, 0x51, 0xea, 0x4d, 0xe1, 0xd6, 0x1f, 0xda, 0xcb, 0x93, 0xd8, 0xd7, 0x74, 0x1f, 0x76, 0x00,
+ 0x38, 0xe6, 0xb8, 0x1d, 0x0a, 0xd6, 0x49, 0x75, 0x25, 0x75, 0x25, 0x56, 0x3f, 0x99, 0x8f, 0xf4,
+ 0xaf, 0x45, 0xb2, 0x89, 0x55, 0x03, 0x1c, 0x66, 0xbc, 0x8c, 0xd6, 0x9c, 0x65, 0x59, 0x37, 0xd8,
+ 0xdb, 0x29, 0xa0, 0xe5, 0x4a, 0xf2, 0xda, 0xe2, 0xac, 0x0c, 0xdc, 0x9a, 0x79, 0xb2, 0x92, 0x53,
+ 0xbc, 0x33, 0x01, 0xf4, 0xe2, 0xaf, 0xc0, 0x15, 0x08, 0x76, 0x5d, 0xde, 0xd5, 0xa6, 0xd7, 0x30,
+ 0xcf, 0x1c, 0x71, 0xba, 0x84, 0x41, 0xd4, 0x20, 0xe4, 0xd7, 0x1c, 0x68, 0xc2, 0x4b, 0x5d, 0x0f,
+ 0x42, 0xb6, 0x0f, 0x0f, 0x27, 0x77, 0x0b, 0xf9, 0x9c, 0xcc, 0xb1, 0xdc, 0xc2, 0x3e, 0x54, 0x32,
+ 0x0f, 0xf6, 0x2b, 0x36, 0x4b, 0xe0, 0x58, 0xab, 0x9c, 0x7d, 0x6b, 0xbc, 0x92, 0xd2, 0xde, 0x68,
+ 0x41, 0xb7, 0x95, 0x50, 0xf7, 0x59, 0x0f, 0x3f, 0x9d, 0x72, 0xfa, 0xae, 0x9b, 0x68, 0xc2, 0x44,
+ 0x9e, 0x34, 0xf3, 0x3a, 0x99, 0x14, 0xfc, 0xc3, 0xdf, 0x22, 0xa6, 0x58, 0x67, 0x17, 0x77, 0xb1,
+ 0xe7, 0x55, 0xcb, 0xe2, 0xd3, 0x74, 0x5d, 0xbc, 0x99, 0x81, 0x73, 0x2a, 0x3e, 0x08, 0x61, 0xc5,
+ 0x40, 0x97, 0x42, 0x33, 0xd6, 0xb1, 0xf5, 0x5b, 0x7b, 0xab, 0x09, 0x41, 0xb7, 0x67, 0x9a, 0x02,
+ 0x33, 0xbb, 0x1c, 0x8f, 0xa8, 0x15, 0x4e, 0x0d, 0x4f, 0xcc, 0xf9, 0x64, 0xc0, 0x7e, 0xc7, 0xd6,
+ 0xbb, 0xe8, 0x52, 0x6a, 0x3a, 0x3b, 0xa2, 0x30, 0x78, 0xb7, 0x45, 0xfd, 0x5e, 0xb2, 0xb3, 0xe9,
+ 0x73, 0xab, 0x5b, 0xdc, 0x9e, 0xb5, 0xd4, 0xf8, 0x33, 0x4b, 0x5d, 0x7b, 0x55, 0x2b, 0x39, 0x22,
+ 0xd6, 0x00, 0x1e, 0x40, 0x3f, 0x8b, 0xd1, 0x6b, 0xcd, 0x05, 0xe1, 0x5e, 0xf5, 0xe9, 0x9f, 0x0b,
+ 0xa7, 0x9d, 0xad, 0x75, 0x09, 0x14, 0x00, 0x86, 0x45, 0x1b, 0x89, 0xea, 0x40, 0xe9, 0xfa, 0x8a,
+ 0x9c, 0x4c, 0x5c, 0x29, 0xb9, 0x23, 0xb6, 0xbe, 0x21, 0xaa, 0x6d, 0x45, 0xd9, 0x9e, 0xa1, 0x7f,
+ 0xaa, 0x5b, 0x69, 0xb6, 0xb1, 0x46, 0xb8, 0x8a, 0x25, 0xc2, 0x22, 0xa0, 0xe0, 0x56, 0x33, 0x78,
+ 0x99, 0xb6, 0x07, 0xf2, 0xa5, 0x08, 0x7a, 0x12, 0x30, 0x0d, 0x64, 0xea, 0xf7, 0xaf, 0xfd, 0xa1,
+ 0x0a, 0x32, 0xef, 0x45, 0xf9, 0x8e, 0x06, 0x40, 0x3e, 0xf5, 0x9b, 0xab, 0x78, 0xf5, 0x20, 0x84,
+ 0x5a, 0x5a, 0x59, 0xa4, 0x8d, 0x8c, 0x12, 0xcb, 0xde, 0xbc, 0x85, 0x87, 0x9d, 0x7f, 0x79, 0x9f,
+ 0x3d, 0x52, 0xa7, 0xb3, 0x76, 0x4a, 0xe7, 0x7b, 0xa7, 0x6b, 0x29, 0x3c, 0x7e, 0x64, 0x6f, 0x9f,
+ 0x70, 0x6a, 0xfd, 0xc3, 0xbb, 0xc5, 0x96, 0x18, 0x38, 0xc8, 0xaf, 0x1e, 0x5d, 0x43, 0x5c, 0xd4,
+ 0x9d, 0x6d, 0x4c, 0xf0, 0x59, 0xa3, 0xae, 0x42, 0xa0, 0xe0, 0x7e, 0x55, 0xd8, 0xe8, 0xb7, 0x13,
+ 0x69, 0x9a, 0x54, 0x76, 0x97, 0x17, 0xaf, 0x74, 0xea, 0x49, 0x32, 0x3f, 0xf2, 0x1e, 0xc2, 0x9c,
+ 0xa9, 0x46, 0x94, 0x39, 0x5c, 0xaf, 0xe4, 0x54, 0x2f, 0x37, 0xcd, 0xcb, 0x62, 0x0f, 0x18, 0x68,
+ 0xf0, 0x6b, 0x1a, 0x7e, 0x59, 0x41, 0x3f, 0x4e, 0x87, 0xd6, 0xbc, 0x83, 0x52, 0xf0, 0xfd, 0xde,
+ 0x9e, 0xe7, 0xe5, 0x2d, 0x1f, 0x63, 0x5e, 0xd5, 0x35, 0xd2, 0x49, 0x6d, 0x22, 0x13, 0x5c, 0x9e,
+ 0xa1, 0x3c, 0x53, 0x44, 0xc8, 0xc1, 0x4f, 0x15, 0xa5, 0x0c, 0x44, 0xe9, 0x3b, 0x2d, 0x8e, 0x95,
+ 0x26, 0xb6, 0x67, 0x94, 0xbb, 0xcf, 0x6d, 0xcb, 0x29, 0x2b, 0xd8, 0xd3, 0x93, 0x56, 0x2b, 0xd4,
+ 0x9f, 0xce, 0xba, 0xb6, 0xd0, 0x7e, 0xd7, 0x29, 0x25, 0xc4, 0x71, 0x13, 0xd7, 0xa5, 0x69, 0x5a,
+ 0x68, 0xfa, 0x15, 0x8e, 0x1a, 0x5f, 0xdf, 0x38, 0xf4, 0x5f, 0xea, 0x6b, 0xdd, 0xa7, 0x51, 0xc9,
+ 0x7b, 0xc8, 0xc2, 0x79, 0xaa, 0xa7, 0xf0, 0xea, 0xce, 0x46, 0x1d, 0x5e, 0xed, 0xd3, 0xcb, 0x85,
+ 0x25, 0x70, 0x7b, 0x2a, 0x93, 0x5b, 0x16, 0x90, 0x6b, 0x77, 0xb1, 0x08, 0x52, 0x01, 0x0a, 0x67,
+ 0x39, 0x7c, 0xe4, 0xfe, 0x03, 0x9a, 0xe9, 0x8d, 0xe4, 0x11, 0xc6, 0x0d, 0xb5, 0x8d, 0xbc, 0x60,
+ 0xfd, 0xd2, 0xec, 0x58, 0x9f, 0xc2, 0xa2, 0x17, 0xb7, 0x33, 0x63, 0x7b, 0x48, 0x13, 0x1f, 0x72,
+ 0x14, 0xd8, 0x0f, 0xe3, 0x54, 0xe4, 0x96, 0xc6, 0x2f, 0x36, 0xc4, 0x4b, 0xe1, 0x8d, 0x8c, 0x39,
+ 0xfc, 0x26, 0xbf, 0x7a, 0xfa, 0xe1, 0x43, 0x75, 0x20, 0x9c, 0x13, 0xf8, 0x72, 0x6b, 0x5e, 0xcb,
+ 0x44, 0xb1, 0xb2, 0xd3, 0x5a, 0xee, 0x2d, 0x29, 0xae, 0x51, 0x3e, 0xfc, 0xee, 0x30, 0x83, 0xda,
+ 0xb3, 0xaf, 0x5a, 0x25, 0x9d, 0xc9, 0x95, 0x21, 0x00, 0xf0, 0x85, 0xb7, 0x35, 0x20, 0xd6, 0x22,
+ 0x16, 0xde, 0x46, 0xf9, 0x64, 0x89, 0x41, 0xca, 0x16, 0x38, 0x27, 0xe9, 0x59, 0xf3, 0x36, 0xf4,
+ 0x3c, 0xfa, 0x8e, 0x75, 0x65, 0xcd, 0x55, 0x9b, 0x3a, 0x7d, 0xed, 0x9d, 0xec, 0xeb, 0x02, 0xd8,
+ 0x59, 0x47, 0x9e, 0x3e, 0x67, 0x28, 0x3f, 0x3c, 0xd6, 0x3e, 0xa9, 0x6d, 0x6b, 0xfd, 0xa6, 0xf0,
+ 0x32, 0xae, 0x0b, 0x14, 0x56, 0x57, 0xdd, 0xb4, 0x9e, 0x01, 0x0c, 0x3a, 0x8c, 0xd6, 0x03, 0x5e,
+ 0x4b, 0x1c, 0xa5, 0xa1, 0x62, 0xb9, 0xf4, 0xa8, 0xe5, 0xb9, 0x96, 0x46, 0x5d, 0xc7, 0x3b, 0x86,
+ 0x09, 0xa4, 0xe0, 0xe5, 0xb9, 0x9c, 0x6d, 0x0d, 0x56, 0xe7, 0x4f, 0xa4, 0x69, 0x97, 0xd6, 0x71,
+ 0x2c, 0x7b, 0xa2, 0x66, 0xc9, 0x62, 0x41, 0xa9, 0xbc, 0x41, 0xa9, 0xc3, 0x1d, 0x97, 0x95, 0x26,
+ 0xc6, 0x9b, 0xbb, 0x0e, 0xbf, 0x4a, 0xe5, 0xee, 0x75, 0xa9, 0x2d, 0xa0, 0x8f, 0x69, 0xd9, 0x84,
+ 0xdb, 0x80, 0x4f, 0x26, 0xb2, 0xd2, 0xe5, 0xee, 0xe7, 0x12, 0x4e, 0xd9, 0x3e, 0x9e, 0x95, 0x0a,
+ 0x8b, 0xbb, 0x7d, 0x0f, 0x6e, 0x86, 0x27, 0x15, 0x8a, 0x82, 0xc3, 0xa7, 0x68, 0xad, 0x1f, 0xa1,
+ 0xad, 0x0d, 0xe7, 0x97, 0x21, 0x1b, 0xb9, 0x60, 0x09, 0xf6, 0xf6, 0xa9, 0x64, 0xbc, 0x07, 0x9c,
+ 0xe6, 0xb3, 0x6e, 0x36, 0x87, 0xdc, 0x87, 0x8c, 0x54, 0x1e, 0x71, 0xf5, 0xad, 0x23, 0x04, 0xcf,
+ 0xa4, 0xa7, 0x28, 0xd2, 0x82, 0x82, 0xd9, 0x1a, 0xa6, 0x7d, 0xe3, 0xad, 0x48, 0x92, 0xf1, 0x8a,
+ 0xc6, 0x59, 0x48, 0xef, 0x53, 0xa5, 0xc1, 0x1d, 0x4d, 0x5b, 0x8d, 0x8b, 0x55, 0x53, 0x35, 0x40,
+ 0xf9, 0xf2, 0xe7, 0x38, 0xa7, 0x3c, 0xe3, 0x18, 0xed, 0x59, 0xc6, 0xf3, 0x20, 0x73, 0x9a, 0x85,
+ 0xee, 0xb1, 0xde, 0xa1, 0xc5, 0xb0, 0xe7, 0x5d, 0x4b, 0xed, 0x37, 0x04, 0xd7, 0x53, 0xe0, 0xcf,
+ 0x04, 0xdd, 0x78, 0x92, 0xe1, 0x6e, 0x2e, 0x83, 0xc3, 0xa6, 0xa9, 0xe5, 0xba, 0x19, 0x7d, 0x97,
+ 0xdb, 0xde, 0x8f, 0x87, 0x9e, 0x13, 0x8f, 0x5e, 0x9c, 0x5f, 0xdf, 0xae, 0xeb, 0x45, 0x6c, 0x47,
+ 0x1f, 0x67, 0x23, 0xa9, 0x3e, 0xd5, 0xed, 0xd0, 0xf9, 0x36, 0xf2, 0x47, 0x1c, 0x6a, 0x15, 0x10,
+ 0x60, 0x28, 0x18, 0x00, 0x0a, 0xb8, 0x42, 0xda, 0xb3, 0xca, 0xc7, 0x66, 0x3c, 0xb7, 0xa7, 0x4b,
+ 0x7e, 0xe6, 0x9e, 0x9d, 0xa7, 0xdb, 0x69, 0xb6, 0x71, 0xdb, 0xdb, 0x44, 0xb1, 0xc6, 0x8b, 0xb4,
+ 0x2a, 0x8c, 0x00, 0x2a, 0xde, 0x45, 0x51, 0x8a, 0xf1, 0x5d, 0xb6, 0x93, 0x9c, 0x9c, 0x55, 0xb5,
+ 0x75, 0x2d, 0xf7, 0x81, 0x35, 0xdb, 0x19, 0xc5, 0xec, 0x7c, 0xbc, 0xd4, 0xaf, 0x79, 0x0f, 0x38,
+ 0x23, 0x91, 0x9a, 0xe7, 0x7c, 0x4f, 0xe1, 0x0d, 0x23, 0xc4, 0xd6, 0x9e, 0x5d, 0xfd, 0xb0, 0x76,
+ 0x03, 0xe4, 0x95, 0x78, 0x92, 0x3f, 0xa1, 0xfe, 0x9d, 0x2b, 0xa2, 0xa8, 0x2e, 0x6e, 0x16, 0x28,
+ 0xc9, 0x35, 0x52, 0xb5, 0xae, 0xc2, 0x9c, 0xa5, 0x19, 0x27, 0x1d, 0xcf, 0x96, 0xfc, 0x55, 0xe0,
+ 0x7d, 0x4f, 0xc3, 0x1a, 0x8b, 0x09, 0xd1, 0xa5, 0xb0, 0x66, 0xfd, 0xcd, 0xd2, 0x8f, 0x95, 0x87,
+ 0xa1, 0xf4, 0x6f, 0x6a, 0xc0, 0x29, 0x8a, 0xfa, 0xa2, 0x4b, 0x98, 0x26, 0x91, 0xad, 0xae, 0x23,
+ 0x8e, 0x58, 0x25, 0xe0, 0xa3, 0xa8, 0x20, 0x8f, 0xa1, 0xaf, 0x19, 0xf8, 0x89, 0xe0, 0xe8, 0x34,
+ 0x1d, 0x44, 0x5d, 0xe9, 0xf1, 0xe2, 0xc2, 0x73, 0xf7, 0x3a, 0xf9, 0x4d, 0xe9, 0xf4, 0x3d, 0xaa,
+ 0xa8, 0x4e, 0x2d, 0x59, 0x1d, 0x93, 0xa9, 0x3a, 0x8f, 0xde, 0x39, 0x2d, 0x1d, 0x3c, 0xb4, 0x00,
+ 0x0c, 0x17, 0x6c, 0x9a, 0xec, 0x90, 0x08, 0xe3, 0x07, 0xd2, 0xb8, 0xbb, 0x29, 0xb6, 0x48, 0x87,
+ 0xd2, 0xb7, 0x06, 0xa1, 0xb9, 0x76, 0x96, 0xeb, 0x5e, 0x36, 0x22, 0x3c, 0xd5, 0x24, 0xd9, 0xf5,
+ 0xd8, 0x65, 0xcb, 0x4a, 0x31, 0x8f, 0x63, 0x79, 0x27, 0xc8, 0xc9, 0x23, 0x26, 0x88, 0xee, 0x5d,
+ 0x26, 0xdd, 0xc7, 0x15, 0x90, 0xb7, 0x5c, 0x64, 0x35, 0x3f, 0xed, 0x58, 0x04, 0x93, 0x5c, 0xae,
+ 0x16, 0x3a, 0x93, 0x37, 0x24, 0xb8, 0x88, 0xd9, 0x34, 0xac, 0xec, 0x26, 0x2d, 0xc0, 0x1d, 0x31,
+ 0x5c, 0xdd, 0xed, 0xcb, 0x34, 0x81, 0x83, 0x74, 0x3d, 0x68, 0x96, 0xf9, 0x99, 0x00, 0xcf, 0x03,
+ 0x8a, 0xc9, 0xba, 0x9c, 0x9c, 0x8c, 0xd3, 0x8c, 0x5e, 0x82, 0x76, 0xb3, 0x4c, 0x91, 0xe4, 0x86,
+ 0x69, 0x08, 0x94, 0x98, 0xd9, 0x4e, 0x41, 0x43, 0xc3, 0x7b, 0x63, 0xb5, 0x48, 0xf6, 0x1e, 0x1d,
+ 0x91, 0x37, 0x49, 0x6e, 0xa1, 0x89, 0xe5, 0x81, 0x23, 0x35, 0x8b, 0x34, 0xdb, 0xb9, 0xc9, 0x06,
+ 0xa8, 0xcb, 0xa8, 0xcf, 0x01, 0xc0, 0xda, 0xf9, 0xf6, 0xe6, 0xba, 0x63, 0x4a, 0x4f, 0xe1, 0x76,
+ 0x67, 0xcc, 0x66, 0xd8, 0x7a, 0xce, 0x49, 0xc5, 0xb7, 0x15, 0xe7, 0xb1, 0xd8, 0xc5, 0x69, 0xe1,
+ 0x74, 0x41, 0xfe, 0x8c, 0xa4, 0x01, 0xd5, 0x9d, 0xab, 0x7f, 0xc3, 0x1a, 0x9e, 0x9f, 0x6e, 0x25,
+ 0xb3, 0xb1, 0x09, 0x12, 0x67, 0x79, 0x55, 0x27, 0x9e, 0xd9, 0xe6, 0xbc, 0xe0, 0x5a, 0xeb, 0x77,
+ 0x4a, 0x0a, 0x59, 0x30, 0x53, 0xd0, 0xf4, 0xa7, 0xc1, 0xa3, 0xeb, 0xb6, 0x97, 0x29, 0x74, 0xb3,
+ 0x45, 0x03, 0xa7, 0x23, 0x2f, 0x9f, 0xc0, 0xd7, 0x43, 0xcb, 0xab, 0xd5, 0x8d, 0xa4, 0x79, 0x34,
+ 0xaa, 0x4e, 0x12, 0x4d, 0xdd, 0xa3, 0xd6, 0x6f, 0x20, 0x13, 0x6f, 0x78, 0xe5, 0x90, 0x86, 0xe4,
+ 0x8c, 0xe4, 0x03, 0xfd, 0x2b, 0x93, 0x96, 0xda, 0x3f, 0xb5, 0x6e, 0xea, 0xfd, 0x80, 0x3d, 0xeb,
+ 0x73, 0x42, 0xd7, 0xe0, 0x9e, 0xdb, 0xca, 0x79, 0x10, 0x4a, 0x06, 0x24, 0x50, 0x73, 0xcf, 0xf8,
+ 0x55, 0xe8, 0x7e, 0xc1, 0x6e, 0xec, 0x61, 0x8e, 0x35, 0xc9, 0xce, 0x47, 0xad, 0x79, 0x4d, 0x4e,
+ 0x83, 0x70, 0x92, 0xd5, 0x1d, 0xd3, 0xa7, 0x1a, 0x8f, 0x99, 0x11, 0x69, 0x3a, 0x45, 0xd3, 0x3a,
+ 0x5d, 0xdc, 0xaa, 0xec, 0x03, 0x6a, 0xa8, 0xf7, 0xad, 0x4b, 0xc8, 0xe2, 0xb7, 0x05, 0x94, 0xe3,
+ 0xdb, 0x3d, 0x2a, 0xb4, 0xba, 0xdc, 0x70, 0x46, 0x7e, 0x70, 0x00, 0xf7, 0xae, 0x33, 0x5b, 0xf1,
+ 0xa5, 0xb1, 0x2d, 0x1c, 0x52, 0x87, 0x3d, 0x0e, 0xde, 0x6b, 0x99, 0x50, 0xa9, 0x5a, 0x7b, 0x1b,
+ 0xa9, 0x46, 0x11, 0x36, 0xef, 0xbc, 0x40, 0x96, 0xb6, 0xd2, 0x31, 0x23, 0x81, 0x5c, 0x87, 0xf6,
+ 0xeb, 0x48, 0xe5, 0xb3, 0x9c, 0xf4, 0xac, 0x4b, 0x9b, 0x8d, 0x47, 0x59, 0x25, 0x6d, 0xa3, 0x2b,
+ 0x18, 0xf5, 0xef, 0x55, 0xff, 0x00, 0xb2, 0x35, 0x98, 0x80, 0x22, 0xd6, 0x46, 0xfa, 0x57, 0xb3,
+ 0x87, 0xcb, 0x25, 0x15, 0xcc, 0xd1, 0xe7, 0xe2, 0x6a, 0x39, 0xe9, 0x1d, 0x8e, 0x9f, 0xfb, 0x5d,
+ 0x9b, 0x1b, 0x8e, 0x07, 0xd6, 0xab, 0xdc, 0x6a, 0x7b, 0xb8, 0x53, 0x5c, 0xf3, 0xc7, 0xaa, 0xa0,
+ 0xc3, 0xda, 0x4e, 0x3f, 0xe0, 0x35, 0x5c, 0xa6, 0xa0, 0x7f, 0xe5, 0xde, 0x6f, 0xfb, 0xe6, 0xbb,
+ 0x3e, 0xad, 0x2d, 0x9a, 0x38, 0x79, 0x5f, 0x63, 0xa6, 0x5d, 0x6a, 0xf1, 0x40, 0x11, 0xcd, 0xb0,
+ 0x01, 0xd1, 0x40, 0x15, 0x52, 0x5d, 0x4e, 0x77, 0x3f, 0x34, 0xcd, 0xef, 0x96, 0xac, 0x75, 0x83,
+ 0x51, 0x7f, 0xbb, 0x6d, 0x2f, 0xe5, 0x4e, 0x1a, 0x7e, 0xa6, 0xdf, 0xf2, 0xe7, 0x2d, 0x35, 0x87,
+ 0x97, 0x61, 0xda, 0x66, 0x81, 0xba, 0x27, 0x92, 0x47, 0xd6, 0x92, 0x3b, 0xa2, 0x18, 0x9f, 0x5e,
+ 0xd5, 0x4d, 0x74, 0x8d, 0x59, 0xc7, 0x16, 0x92, 0x63, 0xea, 0x2a, 0x64, 0xd0, 0x35, 0x86, 0xe7,
+ 0xec, 0xe5, 0x47, 0xbb, 0x0a, 0xbf, 0xab, 0xcf, 0xb1, 0x3c, 0x92, 0xec, 0x4a, 0xf2, 0x0d, 0xd9,
+ 0x07, 0x03, 0xeb, 0x48, 0xd7, 0x21, 0x53, 0xef, 0x0d, 0xd4, 0xe5, 0xf0, 0xce, 0xa8, 0xfc, 0xbb,
+ 0x44, 0xa3, 0xdd, 0xaa, 0x64, 0xf0, 0x8d, 0xd1, 0xc1, 0x96, 0xed, 0x14, 0x7b, 0x29, 0x34, 0xd6,
+ 0x0e, 0xa3, 0xe8, 0x52, 0xa5, 0x37, 0xd0, 0xe7, 0xf5, 0x2b, 0xb6, 0x99, 0x04, 0x47, 0xa0, 0x72,
+ 0xd9, 0xa8, 0x21, 0xbb, 0x68, 0xc8, 0xcf, 0x22, 0xbb, 0x05, 0xf0, 0x7d, 0xb7, 0x59, 0x6e, 0x9d,
+ 0x8f, 0xfb, 0x2a, 0x05, 0x38, 0x78, 0x57, 0x4d, 0x03, 0x93, 0x2b, 0x7d, 0x5b, 0x15, 0xd2, 0xb0,
+ 0x8d, 0x46, 0xcc, 0xe9, 0xa5, 0xed, 0x29, 0xbb, 0xc5, 0x9c, 0xda, 0xdf, 0x07, 0x1d, 0x69, 0xdf,
+ 0x68, 0x5f, 0x51, 0x5d, 0x01, 0xf0, 0xde, 0x9e, 0x9f, 0x76, 0x23, 0xf8, 0xb1, 0xa8, 0xce, 0x91,
+ 0x6f, 0x17, 0x48, 0x57, 0xf2, 0xac, 0xde, 0x0d, 0xa3, 0xd2, 0x8e, 0x36, 0xa5, 0xbd, 0xe3, 0x0f,
+ 0xcf, 0x5f, 0x5a, 0x4f, 0xb4, 0x0e, 0xc6, 0xb6, 0xfe, 0xcb, 0x12, 0x74, 0x8d, 0x47, 0xfc, 0x06,
+ 0x94, 0x44, 0x83, 0xf8, 0x07, 0xe5, 0x49, 0x61, 0xbc, 0xca, 0x78, 0xe9, 0xf6, 0x30, 0xbc, 0xf6,
+ 0xc7, 0x00, 0xfe, 0x55, 0x1b, 0x49, 0x33, 0x74, 0x8d, 0xff, 0x00, 0x2a, 0xe8, 0x0c, 0x6b, 0xd8,
+ 0x54, 0x33, 0x0c, 0x21, 0x20, 0x7e, 0x54, 0xfd, 0x82, 0x46, 0x52, 0xc5, 0x54, 0x67, 0xb8, 0x78,
+ 0x30, 0xc7, 0x65, 0xa4, 0x5a, 0x43, 0x1e, 0x02, 0xa4, 0x4a, 0x3f, 0x1c, 0x56, 0xdd, 0xdd, 0xf1,
+ 0x49, 0x81, 0x04, 0x64, 0xf1, 0x5e, 0x65, 0xe0, 0xef, 0x12, 0xa4, 0xda, 0x7c, 0x71, 0xb3, 0x81,
+ 0x2c, 0x40, 0x23, 0xae, 0x79, 0xe3, 0xbd, 0x74, 0xd7, 0x5a, 0x90, 0x95, 0x73, 0x9a, 0xe4, 0x74,
+ 0xdd, 0xec, 0x72, 0xb9, 0x5f, 0x53, 0xaf, 0xb4, 0xbe, 0x65, 0xf9, 0xdc, 0x8d, 0xc4, 0xfa, 0xd6,
+ 0x8d, 0xbd, 0xe2, 0xe4, 0x36, 0x79, 0xaf, 0x3f, 0xb5, 0xd5, 0xc0, 0x40, 0xa5, 0xf3, 0x83, 0x5a,
+ 0xb0, 0x6b, 0x0b, 0xb0, 0x61, 0xb9, 0xfa, 0xd6, 0x5e, 0xcd, 0xa6, 0x17, 0x4c, 0xed, 0xdb, 0x51,
+ 0x55, 0x42, 0x01, 0xed, 0xd6, 0xb2, 0x6f, 0x6f, 0xcb, 0xc6, 0x7e, 0x6e, 0xb5, 0x84, 0xfa, 0xba,
+ 0xb2, 0x72, 0xdd, 0xbd, 0x6b, 0x32, 0xeb, 0x5b, 0x8d, 0x22, 0x39, 0x71, 0x9f, 0xad, 0x53, 0x52,
+ 0x9e, 0x8c, 0x49, 0x46, 0x3b, 0x1a, 0x4d, 0x7a, 0x3e, 0xd2, 0x01, 0x6e, 0x9d, 0x2b, 0x3b, 0xc6,
+ 0xb2, 0xad, 0xe6, 0x85, 0x73, 0x13, 0xf3, 0x88, 0xf2, 0x3d, 0x88, 0xe4, 0x56, 0x24, 0x1a, 0xa8,
+ 0x96, 0xe8, 0xb9, 0x6f, 0x94, 0x1f, 0xce, 0xaa, 0x6b, 0xba, 0xba, 0xcd, 0x6f, 0x24, 0x41, 0xb2,
+ 0x5c, 0x6d, 0x15, 0xad, 0x3a, 0x72, 0xe7, 0x49, 0x0e, 0xe7, 0x9c, 0x87, 0x31, 0xc9, 0x91, 0x56,
+ 0xa3, 0x9b, 0x76, 0x39, 0xaa, 0xb2, 0xae, 0x10, 0x11, 0xda, 0xa2, 0x49, 0x30, 0x69, 0x62, 0xa8,
+ 0xda, 0x57, 0x3d, 0xfc, 0x06, 0x23, 0x9a, 0x9a, 0x5d, 0x8d, 0x85, 0xba, 0xdb, 0xd0, 0xd2, 0x9b,
+ 0xc3, 0x8c, 0x66, 0xb2, 0x7c, 0xd3, 0xeb, 0x41, 0x98, 0xfa, 0xd7, 0x1f, 0xb2, 0x3d, 0x1f, 0x6a,
+ 0x8d, 0x06, 0xba, 0xe3, 0xad, 0x51, 0x9e, 0xe8, 0xb3, 0x75, 0xa8, 0x5e, 0x6c, 0x0e, 0xb5, 0x55,
+ 0xe5, 0xef, 0x56, 0xa9, 0x99, 0x4e, 0xb5, 0x91, 0x24, 0x93, 0x61, 0x4d, 0x4b, 0xa3, 0x46, 0x92,
+ 0xea, 0x71, 0xc9, 0x28, 0x0c, 0xaa, 0xc3, 0x00, 0xf7, 0x35, 0x99, 0x24, 0xd9, 0x35, 0xa7, 0xa6,
+ 0x1d, 0x92, 0xdb, 0xaf, 0x72, 0x77, 0x1a, 0xee, 0xc2, 0xd2, 0xf7, 0xee, 0x78, 0xd8, 0xcc, 0x45,
+ 0xd5, 0x8e, 0x9f, 0x50, 0xd5, 0x6f, 0xac, 0xa5, 0x28, 0x55, 0x4c, 0x67, 0xee, 0xb0, 0x1d, 0xab,
+ 0x1e, 0xe7, 0x56, 0x96, 0xe0, 0x10, 0xdc, 0x7d, 0x2b, 0xa1, 0x95, 0x52, 0xee, 0xd7, 0x63, 0x8d,
+ 0xdc, 0x57, 0x37, 0x77, 0x64, 0x61, 0x62, 0x3b, 0x76, 0x35, 0xea, 0xd4, 0xe6, 0x5d, 0x74, 0x3c,
+ 0xc6, 0x66, 0x96, 0x22, 0x4d, 0xe8, 0xec, 0x8e, 0x3a, 0x32, 0x9c, 0x1a, 0x94, 0x6a, 0x5a, 0x9a,
+ 0x1f, 0x96, 0xfe, 0x5f, 0xc4, 0xe6, 0xa0, 0x9a, 0x36, 0x53, 0x9a, 0x80, 0x96, 0x15, 0xc9, 0x2a,
+ 0x70, 0x97, 0xc4, 0xae, 0x45, 0xda, 0x2c, 0xcf, 0x71, 0x7b, 0x77, 0xc5, 0xc5, 0xdc, 0xae, 0x3f,
+ 0xba, 0x5b, 0x8f, 0xca, 0xa4, 0xb4, 0xb5, 0x8d, 0x48, 0x66, 0x02, 0xaa, 0x2b, 0x9c, 0xf3, 0x53,
+ 0xa4, 0xc4, 0x0e, 0xb4, 0xe3, 0x4e, 0x31, 0xd1, 0x21, 0xa7, 0xad, 0xd9, 0xd2, 0x5a, 0x5e, 0x45,
+ 0x02, 0x80, 0xaa, 0x2b, 0x46, 0x3d, 0x5d, 0x00, 0xeb, 0x5c, 0x78, 0xb8, 0x3e, 0xb5, 0x2a, 0xce,
+ 0x58, 0x70, 0x6b, 0x78, 0xd4, 0x6b, 0x62, 0xae, 0x75, 0xcd, 0xaa, 0xc4, 0x46, 0x32, 0x0f, 0xb5,
+ 0x44, 0xda, 0x8c, 0x3e, 0x83, 0xe9, 0x5c, 0xd0, 0x90, 0x8e, 0xf4, 0xf1, 0x2f, 0x14, 0xfd, 0xab,
+ 0x0b, 0x9d, 0x07, 0xf6, 0x8c, 0x40, 0xf0, 0xa2, 0x97, 0xfb, 0x55, 0x00, 0xae, 0x78, 0xc9, 0xe9,
+ 0x4d, 0x0c, 0x4b, 0x75, 0xa3, 0xda, 0x30, 0xb9, 0xd0, 0x8d, 0x5b, 0x70, 0xe0, 0x71, 0x49, 0xfd,
+ 0xa2, 0x7a, 0xe4, 0xe0, 0x56, 0x09, 0x93, 0x69, 0xeb, 0x4a, 0x65, 0x76, 0x50, 0xbd, 0x8d, 0x1e,
+ 0xd1, 0x85, 0xcd, 0xa4, 0xbd, 0x6b, 0x97, 0x2e, 0xcc, 0x42, 0xaf, 0x41, 0x4e, 0x6b, 0x89, 0x97,
+ 0x9c, 0x6e, 0x5e, 0xc4, 0x56, 0x28, 0xb8, 0x31, 0x8d, 0xa0, 0x9a, 0x12, 0xf1, 0xe3, 0x6c, 0xab,
+ 0x1a, 0x39, 0xc2, 0xe6, 0xcf, 0xdb, 0xc8, 0x1f, 0x30, 0xa5, 0xfb, 0x4a, 0x3f, 0x43, 0x83, 0x59,
+ 0x3f, 0xda, 0x21, 0xbe, 0xf2, 0x8a, 0x69, 0xb8, 0x89, 0xb9, 0x07, 0x1f, 0x4a, 0x39, 0xc2, 0xe6,
+ 0xb9, 0x9d, 0x73, 0x83, 0xd6, 0x9a, 0x5d, 0x0f, 0x1d, 0xeb, 0x2b, 0xcf, 0xe3, 0xef, 0xe6, 0x9a,
+ 0x6e, 0x08, 0x1c, 0xf2, 0x3b, 0x1a, 0x5c, 0xe1, 0x73, 0x46, 0x45, 0x8c, 0xd4, 0x46, 0x25, 0x27,
+ 0xad, 0x53, 0xfb, 0x4f, 0x3d, 0x69, 0x45, 0xcd, 0x4b, 0x68, 0x77, 0x2d, 0x7d, 0x9c, 0x1e, 0xf4,
+ 0x1b, 0x24, 0x61, 0xd6, 0xab, 0x8b, 0x9f, 0xf6, 0xa9, 0xc2, 0xf0, 0x67, 0xad, 0x1a, 0x05, 0xc8,
+ 0x1b, 0x4b, 0x92, 0xda, 0x6f, 0x3a, 0xd6, 0x67, 0x89, 0xfd, 0x56, 0xac, 0x7f, 0x6b, 0xeb, 0x51,
+ 0x26, 0xdf, 0x32, 0x39, 0x3d, 0xc8, 0x20, 0xd2, 0x9b, 0xb0, 0xc3, 0x8a, 0x88, 0xcc, 0x0d, 0x44,
+ 0xa1, 0x16, 0x4d, 0x91, 0x58, 0x78, 0x8f, 0x59, 0xb6, 0x9b, 0x71, 0x08, 0x47, 0x75, 0xc1, 0xc5,
+ 0x5c, 0x87, 0xc7, 0x17, 0x91, 0xbe, 0x65, 0xb6, 0xc8, 0xff, 0x00, 0x65, 0xaa, 0x06, 0x2a, 0xdd,
+ 0x40, 0x35, 0x03, 0xdb, 0xc4, 0xc7, 0xee, 0xe2, 0xa1, 0xd2, 0x44, 0xf2, 0xbe, 0x8c, 0xdb, 0x7f,
+ 0x1f, 0x0f, 0x27, 0x09, 0x6f, 0x31, 0x7c, 0x74, 0x38, 0x02, 0xb1, 0x27, 0xf1, 0x2d, 0xfd, 0xcc,
+ 0x85, 0x8a, 0x9d, 0xa7, 0xa0, 0x07, 0xa5, 0x47, 0xf6, 0x48, 0xf3, 0xd6, 0xa6, 0x58, 0xa3, 0x4e,
+ 0x8a, 0x29, 0x2a, 0x48, 0x2d, 0x27, 0xb9, 0x24, 0x7a, 0xfe, 0xa4, 0xb1, 0xed, 0x8e, 0xd9, 0x7d,
+ 0x89, 0x34, 0xdb, 0x79, 0xaf, 0xe6, 0xbb, 0x12, 0xdc, 0x39, 0x63, 0xfd, 0xd1, 0xd0, 0x53, 0xc1,
+ 0x02, 0xa6, 0x8a, 0x55, 0x43, 0x5a, 0x42, 0x0a, 0x2e, 0xe8, 0x7c, 0xa5, 0x59, 0x18, 0xf4, 0x15,
+ 0x50, 0xb6, 0xd6, 0xc1, 0xa9, 0xee, 0x2d, 0xee, 0x47, 0xdd, 0xcf, 0xd2, 0xb3, 0xde, 0xde, 0xef,
+ 0x39, 0xd8, 0x4f, 0xe3, 0x53, 0x5e, 0x0a, 0x71, 0xb2, 0xdc, 0xdf, 0x0d, 0x5d, 0xd1, 0x9d, 0xde,
+ 0xc5, 0xad, 0xe3, 0x1d, 0x6a, 0x07, 0x97, 0x1d, 0x2a, 0x33, 0x15, 0xde, 0x3f, 0xd5, 0x1f, 0xce,
+ 0xa0, 0x91, 0x6e, 0x07, 0x58, 0x5f, 0xf2, 0xae, 0x0f, 0x63, 0x25, 0xd0, 0xf5, 0x25, 0x8c, 0x85,
+ 0xb7, 0x24, 0x79, 0x7d, 0xea, 0x09, 0x26, 0xf7, 0xaa, 0xee, 0xf2, 0x0e, 0xa8, 0xe3, 0xfe, 0x02,
+ 0x6a, 0x16, 0x66, 0x3d, 0x8f, 0xe3, 0x5a, 0x2a, 0x67, 0x05, 0x5c, 0x6f, 0x62, 0x63, 0x26, 0xe7,
+ 0x03, 0xde, 0xb6, 0x34, 0xb6, 0x2f, 0x7d, 0x10, 0xf7, 0xfe, 0x95, 0x83, 0x18, 0x6d, 0xe0, 0x9a,
+ 0xdc, 0xd1, 0xf8, 0xbe, 0x88, 0xfb, 0xe2, 0xba, 0xa8, 0xab, 0x33, 0x8b, 0xda, 0x39, 0xbb, 0xb3,
+ 0xb5, 0x81, 0xf6, 0x60, 0x60, 0x9c, 0xd3, 0xe6, 0xb6, 0x8a, 0xe5, 0x4f, 0x40, 0xc6, 0x9a, 0x88,
+ 0x1d, 0x05, 0x4c, 0xb1, 0x63, 0x90, 0x72, 0x6b, 0xbe, 0xc6, 0x87, 0x39, 0x79, 0x63, 0x24, 0x24,
+ 0xee, 0x42, 0x57, 0xd4, 0x56, 0x64, 0x90, 0x57, 0x75, 0xb3, 0x70, 0xc3, 0x00, 0x47, 0xbd, 0x53,
+ 0x9f, 0x47, 0xb7, 0x9f, 0x25, 0x41, 0x8d, 0x8f, 0x71, 0xd2, 0xb2, 0x95, 0x2e, 0xc2, 0x68, 0xe2,
+ 0x8c, 0x44, 0x53, 0x4a, 0x91, 0x5d, 0x1d, 0xc6, 0x85, 0x71, 0x1f, 0x2a, 0x04, 0x83, 0xdb, 0xad,
+ 0x65, 0x4d, 0x6a, 0xd1, 0xb1, 0x0c, 0xa5, 0x48, 0xec, 0x45, 0x64, 0xe2, 0xd6, 0xe4, 0xf2, 0x94,
+ 0x3a, 0x1e, 0x2a, 0x40, 0xe7, 0x81, 0x48, 0xf1, 0x15, 0xcd, 0x42, 0x72, 0xbd, 0xe9, 0x5c, 0x9d,
+ 0x8b, 0xa9, 0x20, 0xa9, 0x83, 0x82, 0x79, 0xac, 0xc5, 0x90, 0x83, 0x53, 0xa4, 0xd9, 0xa0, 0x6a,
+ 0x45, 0xe0, 0x69, 0x48, 0xaa, 0xeb, 0x28, 0xab, 0x01, 0x83, 0x2e, 0x45, 0x32, 0x87, 0xa9, 0xdc,
+ 0x3b, 0x66, 0x8d, 0xac, 0xbc, 0xf7, 0xa8, 0xf2, 0x47, 0x2b, 0xd6, 0x85, 0x95, 0xf3, 0x82, 0x79,
+ 0xa0, 0x09, 0x0b, 0x7a, 0xd2, 0x1c, 0x11, 0xd2, 0x97, 0x6e, 0x7a, 0xf4, 0xa6, 0xb2, 0x91, 0x48,
+ 0x08, 0xca, 0x8c, 0xf2, 0x29, 0x84, 0x01, 0x53, 0x15, 0xc8, 0xa8, 0xd8, 0x15, 0xeb, 0x40, 0x11,
+ 0x91, 0xfd, 0xd6, 0xa5, 0x0c, 0x47, 0x06, 0x94, 0x80, 0x79, 0x02, 0x9a, 0xc3, 0x8e, 0x68, 0x10,
+ 0x16, 0x23, 0x81, 0x48, 0x24, 0x22, 0x8e, 0x4d, 0x21, 0x5c, 0x73, 0x40, 0x07, 0x98, 0x68, 0xf3,
+ 0x69, 0x0a, 0xe7, 0xd2, 0x98, 0x56, 0x81, 0x13, 0x09, 0x48, 0xef, 0x4f, 0xf3, 0x7d, 0xea, 0xa9,
+ 0xa3, 0x38, 0x34, 0x05, 0xcb, 0x5e, 0x68, 0xf5, 0xa5, 0xf3, 0x7d, 0xea, 0xa6, 0xea, 0x4d, 0xd4,
+ 0x0e, 0xe5, 0xcf, 0x36, 0x8f, 0x33, 0x9a, 0xa6, 0x24, 0xa7, 0x09, 0x28, 0x0b, 0x96, 0xf7, 0xf3,
+ 0x46, 0xf3, 0x55, 0x44, 0x9c, 0x52, 0x34, 0xdb, 0x68, 0x0b, 0x9d, 0x7c, 0xb6, 0xbb, 0xbb, 0x55,
+ 0x39, 0x2c, 0x5b, 0x9c, 0x0a, 0xd6, 0x57, 0x46, 0x3d, 0x69, 0x7e, 0x5c, 0x75, 0xae, 0xb7, 0x04,
+ 0xcb, 0x31, 0x05, 0x9b, 0xfa, 0x54, 0x8b, 0x62, 0x3b, 0x8a, 0xd8, 0x01, 0x4d, 0x35, 0x90, 0x76,
+ 0xa5, 0xec, 0x90, 0x14, 0x16, 0xd2, 0x20, 0x39, 0x41, 0x4c, 0x78, 0xa2, 0x03, 0x1e, 0x4a, 0x1f,
+ 0xa8, 0xab, 0x8e, 0x55, 0x07, 0x35, 0x5a, 0x46, 0x06, 0x93, 0x49, 0x01, 0x42, 0x68, 0x60, 0x20,
+ 0xe6, 0xde, 0x2f, 0xfb, 0xe4, 0x55, 0x48, 0x22, 0x8d, 0x6f, 0xa3, 0xd9, 0x18, 0x5e, 0x7b, 0x55,
+ 0xf9, 0x01, 0xeb, 0x51, 0x42, 0x98, 0x9c, 0x39, 0xe0, 0x01, 0x9a, 0xce, 0xda, 0x8a, 0xc6, 0xc2,
+ 0x3f, 0x02, 0xad, 0xa3, 0x64, 0x56, 0x32, 0xdc, 0x05, 0xe6, 0xaf, 0xdb, 0xdc, 0x2b, 0xe3, 0x1d,
+ 0x7b, 0xd6, 0xb1, 0x90, 0xcd, 0x00, 0x7d, 0xe9, 0xc0, 0xe0, 0x52, 0x20, 0xc8, 0xc8, 0xe9, 0x4b,
+ 0x8f, 0x6a, 0xd0, 0x00, 0x92, 0x00, 0xa2, 0x48, 0x61, 0x9d, 0x36, 0xcb, 0x10, 0x61, 0xee, 0x28,
+ 0x1c, 0x76, 0xa0, 0x38, 0xc5, 0x00, 0x66, 0xdc, 0xf8, 0x6e, 0xd6, 0x70, 0x4c, 0x0e, 0x62, 0x6f,
+ 0x43, 0xc8, 0xac, 0x1b, 0xdf, 0x0d, 0xde, 0xc1, 0x96, 0x11, 0x79, 0x8a, 0x3b, 0xa7, 0x3f, 0xa5,
+ 0x76, 0x42, 0x50, 0x38, 0x15, 0x22, 0xcc, 0x6a, 0x1d, 0x28, 0x31, 0x38, 0x9e, 0x5b, 0x34, 0x0f,
+ 0x11, 0x21, 0x94, 0x82, 0x3d, 0x45, 0x40, 0x5c, 0x8a, 0xf5, 0x3b, 0x9b, 0x6b, 0x3b, 0xd1, 0x8b,
+ 0x98, 0x11, 0xfd, 0xc8, 0xe7, 0xf3, 0xac, 0x2b, 0xdf, 0x06, 0xda, 0x4f, 0x96, 0xb4, 0xb8, 0x68,
+ 0x5b, 0xfb, 0xaf, 0xc8, 0xac, 0xa5, 0x42, 0x4b, 0x62, 0x1c, 0x1f, 0x43, 0x8b, 0x59, 0xd8, 0x55,
+ 0x88, 0xae, 0x48, 0x35, 0x6e, 0xf3, 0xc2, 0xda, 0xa5, 0xa6, 0x58, 0x41, 0xe7, 0x20, 0xfe, 0x28,
+ 0x8e, 0x7f, 0x4e, 0xb5, 0x8e, 0xe2, 0x58, 0x9b, 0x6c, 0x88, 0xca, 0x47, 0x62, 0x31, 0x58, 0xb5,
+ 0x28, 0xee, 0x88, 0xbb, 0x5b, 0x9a, 0xab, 0x72, 0x18, 0xd4, 0xdb, 0xc1, 0x19, 0xea, 0x2b, 0x10,
+ 0x4c, 0x45, 0x4f, 0x1d, 0xd3, 0x29, 0xe0, 0xe7, 0xda, 0x95, 0xca, 0x53, 0x35, 0xd1, 0xc7, 0xf7,
+ 0xb3, 0x53, 0x8c, 0x37, 0x22, 0xb2, 0x56, 0xe0, 0x3f, 0x3d, 0x0d, 0x58, 0x8e, 0xe7, 0x6f, 0x7a,
+ 0x65, 0xa6, 0x5f, 0xda, 0x3d, 0x29, 0x0a, 0x76, 0x3d, 0x2a, 0x15, 0xba, 0x07, 0xad, 0x4e, 0x92,
+ 0x23, 0x0e, 0xb4, 0x0c, 0x89, 0xa2, 0x1d, 0x69, 0x86, 0x31, 0xdf, 0xad, 0x5a, 0x21, 0x4f, 0xd6,
+ 0x9a, 0x53, 0x34, 0x05, 0x8a, 0x85, 0x14, 0x75, 0xa4, 0xc2, 0xe3, 0x9a, 0xb4, 0x53, 0xaf, 0x43,
+ 0x51, 0xb4, 0x00, 0xf4, 0x14, 0x05, 0x8a, 0xec, 0x98, 0xe4, 0x53, 0x48, 0xcf, 0x6a, 0xb1, 0xe5,
+ 0xe3, 0x8a, 0x4d, 0x82, 0x81, 0x58, 0xaa, 0x56, 0x98, 0x45, 0x5a, 0x31, 0x7e, 0x55, 0x1b, 0x43,
+ 0xe8, 0x28, 0x15, 0x8a, 0xf9, 0xc1, 0xa4, 0xdc, 0x0d, 0x4a, 0xd1, 0x9e, 0xe2, 0xa3, 0x68, 0xc8,
+ 0xe7, 0x14, 0x85, 0x61, 0x08, 0xa4, 0x23, 0xda, 0x90, 0xb1, 0x14, 0xc2, 0xc6, 0x81, 0x0f, 0xc9,
+ 0x1f, 0x4a, 0x69, 0xc9, 0xa6, 0x16, 0x3d, 0xe8, 0xdd, 0xef, 0x40, 0xae, 0x7f, 0xff, 0xd9,
+};
@@ -0,0 +1,8 @@
+
+#include <stdint.h>
+
+#define PEPPERS_JPG_SIZE 11599
+#define PEPPERS_JPG_W 320
+#define PEPPERS_JPG_H 240
+
+extern const uint8_t peppers_jpg[PEPPERS_JPG_SIZE];
@@ -0,0 +1,28 @@
+"""
+RGB888 to RGB565 conversion shared by the sprite scripts
+(convert_sprites.py, generate_sprites.py).
+"""
+
+# 4x4 Bayer matrix for ordered dithering (thresholds 0-15).
+BAYER4 = [
+    [ 0,  8,  2, 10],
+    [12,  4, 14,  6],
+    [ 3, 11,  1,  9],
+    [15,  7, 13,  5],
+]
+
+def rgb888_to_rgb565(r, g, b):
+    """Convert 24-bit RGB to 16-bit RGB565."""
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | ((b & 0xF8) >> 3)
+
+def rgb888_to_rgb565_dither(r, g, b, x, y):
+    """Convert 24-bit RGB to 16-bit RGB565 with 4x4 ordered dithering.
+    Each channel is scaled to its 5 or 6 bit range and rounded up when the
+    fraction exceeds the Bayer threshold at (x, y), so gradients keep their
+    average color instead of banding. Never returns the transparent key."""
+    t = (BAYER4[y & 3][x & 3] + 0.5) / 16
+    r5 = min(31, int(r * 31 / 255 + t))
+    g6 = min(63, int(g * 63 / 255 + t))
+    b5 = min(31, int(b * 31 / 255 + t))
+    val = (r5 << 11) | (g6 << 5) | b5
+    return 0xFFDF if val == 0xFFFF else val
@@ -5,6 +5,7 @@
 #include "freertos/FreeRTOS.h"
 
 #include "lcd.h"
+#include "lcd_cmd.h"
 #include "lcd_printf.h"
 
 #define FONT_SZ 1
@@ -21,6 +22,31 @@
 static SemaphoreHandle_t sema_h;
 static StaticSemaphore_t sema_buf;
 static coord_t xpos, ypos;
+static bool direct; // no owner task, draw under the mutex
+
+
+// Draw a line segment, or queue it for the LCD owner task split to fit
+// commands.
+static void lcd_putSegment(coord_t xs, coord_t ys, char *b, coord_t len)
+{
+	if (direct) {
+		char c = b[len];
+		b[len] = '\0'; // Replace next char with NULL character
+		lcd_drawString(xs, ys, b, FONT_CLR);
+		b[len] = c;
+		return;
+	}
+	while (len > 0) {
+		coord_t n = (len < LCD_CMD_TEXT-1) ? len : LCD_CMD_TEXT-1;
+		lcd_cmd_t cmd = {.op = LCD_CMD_STRING, .color = FONT_CLR, .x0 = xs, .y0 = ys};
+		memcpy(cmd.text, b, n);
+		cmd.text[n] = '\0';
+		lcd_cmdSubmit(&cmd);
+		xs += n * FONT_W;
+		b += n;
+		len -= n;
+	}
+}
 
 
 // Print formatted data from variable argument list to LCD.
@@ -32,31 +58,37 @@ int lcd_vprintf(const char* fmt, va_list args)
 
 	int cnt = vsnprintf(buf, BUF_SZ, fmt, args);
 
+	// With the LCD owner task (lcd_cmdInit()) the mutex only guards the
+	// cursor, so no caller waits on SPI while holding it. Without it, as
+	// in main_v1.c, the mutex also serializes drawing directly.
 	if (sema_h == NULL) sema_h = xSemaphoreCreateMutexStatic(&sema_buf);
 	xSemaphoreTake(sema_h, portMAX_DELAY);
-	lcd_setFontSize(FONT_SZ);
-	lcd_setFontBackground(FONT_BKG);
+	direct = !lcd_cmdActive();
+	if (direct) {
+		lcd_setFontSize(FONT_SZ);
+		lcd_setFontBackground(FONT_BKG);
+	} else {
+		lcd_cmdSubmit(&(lcd_cmd_t){.op = LCD_CMD_FONT_SIZE, .x0 = FONT_SZ});
+		lcd_cmdSubmit(&(lcd_cmd_t){.op = LCD_CMD_FONT_BACK, .color = FONT_BKG});
+	}
 	for (b = buf; (s = strpbrk(b, "\r\n")); b = s+1) { // Break into lines
 		char cc = *s; // Control character
 		len = s - b;
 		if (len) { // Length greater than zero
-			*s = '\0'; // Replace control char with NULL character
-			coord_t xs = xpos * FONT_W;
-			coord_t ys = ypos * FONT_H;
-			lcd_drawString(xs, ys, b, FONT_CLR);
+			lcd_putSegment(xpos * FONT_W, ypos * FONT_H, b, len);
 		}
 		xpos = 0;
 		if (cc == '\n') {
 			if (++ypos >= ROWS) ypos = 0;
 			// Clear next line
-			lcd_fillRect(0, ypos * FONT_H, LCD_W, FONT_H, FONT_BKG);
+			if (direct) lcd_fillRect(0, ypos * FONT_H, LCD_W, FONT_H, FONT_BKG);
+			else lcd_cmdSubmit(&(lcd_cmd_t){.op = LCD_CMD_FILL_RECT, .color = FONT_BKG,
+				.x0 = 0, .y0 = ypos * FONT_H, .x1 = LCD_W, .y1 = FONT_H});
 		}
 	}
 	len = strlen(b);
 	if (len) { // Last segment without a newline.
-		coord_t xs = xpos * FONT_W;
-		coord_t ys = ypos * FONT_H;
-		lcd_drawString(xs, ys, b, FONT_CLR);
+		lcd_putSegment(xpos * FONT_W, ypos * FONT_H, b, len);
 		xpos += len;
 	}
 	xSemaphoreGive(sema_h);
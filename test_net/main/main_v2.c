@@ -12,6 +12,7 @@
 #include "hw.h"
 #include "net.h"
 #include "lcd.h"
+#include "lcd_cmd.h"
 #include "lcd_printf.h"
 
 #ifdef LCD_PRINTF_H_
@@ -27,6 +28,7 @@
 
 #define STACK_SZ 2048 // receive task stack size
 #define PRIORITY 4 // receive task priority
+#define LCD_PRIORITY 3 // LCD owner task priority
 
 typedef struct {
 	uint32_t i;
@@ -143,6 +145,11 @@ void app_main(void)
 
 	ESP_LOGI(TAG, "app_main");
 	lcd_init(); // Clears display
+	// All printing from here on goes through the LCD owner task.
+	if (lcd_cmdInit(LCD_PRIORITY)) {
+		ESP_LOGE(TAG, "lcd_cmdInit() fail");
+		return;
+	}
 
 	gpio_reset_pin(HW_BTN_START);
 	gpio_set_direction(HW_BTN_START, GPIO_MODE_INPUT);